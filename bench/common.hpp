@@ -0,0 +1,115 @@
+#ifndef BENCH_COMMON_HPP
+#define BENCH_COMMON_HPP
+
+/**
+ * @brief Partes comuns aos benchmarks que leem um arquivo .convcc.
+ *
+ * - `NullBuffer`: descarta a saída do parser enquanto ele roda;
+ * - `load`: abre o arquivo, tokeniza e (opcionalmente) constrói a AST uma única
+ *   vez, antes das medições;
+ * - `repeatArg`: o número de repetições vindo da linha de comando.
+ *
+ * Definindo `BENCH_COUNT_ALLOCATIONS` antes de incluir este arquivo, o
+ * `operator new` global é substituído por um que conta as alocações em
+ * `allocCount`. Como a substituição não pode ser inline, a macro só pode ser
+ * definida em um arquivo de cada executável.
+ */
+
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <new>
+#include <streambuf>
+
+#include "arena.hpp"
+#include "lexer.hpp"
+#include "parser.hpp"
+#include "source_file.hpp"
+#include "symbol_table.hpp"
+#include "token_buffer.hpp"
+
+#ifdef BENCH_COUNT_ALLOCATIONS
+static size_t allocCount = 0;
+
+void *operator new(std::size_t size)
+{
+    ++allocCount;
+    if (void *p = std::malloc(size ? size : 1))
+        return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void *p) noexcept
+{
+    std::free(p);
+}
+
+void operator delete(void *p, std::size_t) noexcept
+{
+    std::free(p);
+}
+#endif
+
+namespace bench
+{
+    // Descarta tudo o que é escrito (a saída do parser não interessa aqui)
+    class NullBuffer : public std::streambuf
+    {
+    protected:
+        int overflow(int c) override { return c; }
+        std::streamsize xsputn(const char *, std::streamsize n) override { return n; }
+    };
+
+    // Um arquivo já tokenizado e, se pedido a `load`, analisado. O parser
+    // guarda uma referência a `tokens` e os nós ficam em `arena`
+    struct ParsedFile
+    {
+        SourceFile source;
+        SymbolTable symtab;
+        TokenBuffer tokens;
+        Arena arena;
+        std::unique_ptr<Parser> parser;
+
+        ASTNode *root() const { return parser ? parser->root : nullptr; }
+    };
+
+    /**
+     * @brief Abre e tokeniza `path` e, com `build`, constrói a AST com a saída
+     * do parser descartada. Se o arquivo não abrir ou tiver erros sintáticos,
+     * escreve o erro em stderr e devolve false.
+     */
+    inline bool load(const char *path, ParsedFile &file, bool build = true)
+    {
+        if (!file.source.open(path))
+        {
+            std::cerr << "Erro: não foi possível abrir o arquivo '" << path << "'\n";
+            return false;
+        }
+        Lexer lex(file.source.contents(), file.symtab);
+        file.tokens = TokenBuffer::lexAll(lex, file.source.contents());
+        if (!build)
+            return true;
+
+        NullBuffer null;
+        std::streambuf *coutBuf = std::cout.rdbuf(&null);
+        file.parser = std::make_unique<Parser>(file.tokens);
+        file.parser->setArena(&file.arena);
+        file.parser->buildTree();
+        std::cout.rdbuf(coutBuf);
+        if (!file.parser->root)
+        {
+            std::cerr << "Erro: o programa tem erros sintáticos\n";
+            return false;
+        }
+        return true;
+    }
+
+    // `argv[index]` como número de repetições, ou `fallback` se faltar; nunca zero
+    inline unsigned repeatArg(int argc, char **argv, int index, unsigned fallback)
+    {
+        unsigned repeat = argc > index ? (unsigned)std::strtoul(argv[index], nullptr, 10) : fallback;
+        return repeat == 0 ? 1 : repeat;
+    }
+}
+
+#endif
@@ -0,0 +1,228 @@
+#ifndef BENCH_CORPUS_HPP
+#define BENCH_CORPUS_HPP
+
+/**
+ * @brief Gerador de programas ConvCC sintéticos para os benchmarks.
+ *
+ * Cada tipo de corpus estressa uma parte diferente do Lexer:
+ * - `ident`: declarações, atribuições e chamadas com identificadores longos;
+ * - `numeric`: expressões com muitas constantes inteiras e de ponto flutuante;
+ * - `string`: comandos print e atribuições com strings longas;
+ * - `operator`: expressões com nomes curtos e muitos operadores e delimitadores.
+ *
+ * O texto é gerado linha a linha por um gerador pseudoaleatório com semente fixa,
+ * então o mesmo tipo e tamanho produzem sempre o mesmo corpus.
+ */
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace corpus
+{
+    enum class Kind
+    {
+        Ident,
+        Numeric,
+        String,
+        Operator
+    };
+
+    inline const std::vector<Kind> &allKinds()
+    {
+        static const std::vector<Kind> kinds{Kind::Ident, Kind::Numeric, Kind::String, Kind::Operator};
+        return kinds;
+    }
+
+    inline const char *name(Kind kind)
+    {
+        switch (kind)
+        {
+        case Kind::Ident:
+            return "ident";
+        case Kind::Numeric:
+            return "numeric";
+        case Kind::String:
+            return "string";
+        case Kind::Operator:
+            return "operator";
+        }
+        return "?";
+    }
+
+    // xorshift64: rápido e determinístico (std::mt19937 varia entre distribuições)
+    class Random
+    {
+    private:
+        uint64_t state;
+
+    public:
+        explicit Random(uint64_t seed) : state(seed ? seed : 1) {}
+
+        uint32_t next()
+        {
+            state ^= state << 13;
+            state ^= state >> 7;
+            state ^= state << 17;
+            return (uint32_t)(state >> 32);
+        }
+
+        uint32_t below(uint32_t n) { return next() % n; }
+    };
+
+    namespace detail
+    {
+        inline const char *const prefixes[] = {
+            "customer_record", "total_amount", "base_value", "adjustment_factor",
+            "input_buffer", "output_index", "matrix_row", "matrix_column",
+            "temporary_result", "accumulated_sum", "loop_counter", "element_weight"};
+
+        inline void identifier(std::string &out, Random &rng)
+        {
+            out += prefixes[rng.below(sizeof(prefixes) / sizeof(prefixes[0]))];
+            out += '_';
+            out += std::to_string(rng.below(5000));
+        }
+
+        inline void number(std::string &out, Random &rng)
+        {
+            out += std::to_string(rng.below(1000000000));
+            if (rng.below(2))
+            {
+                out += '.';
+                out += std::to_string(rng.below(100000));
+            }
+        }
+
+        inline void text(std::string &out, Random &rng)
+        {
+            static const char *const words[] = {
+                "compilador", "analise", "lexica", "token", "programa", "resultado",
+                "valor", "entrada", "saida", "teste", "ConvCC", "linha"};
+            out += '"';
+            size_t count = 3 + rng.below(12);
+            for (size_t i = 0; i < count; ++i)
+            {
+                if (i)
+                    out += ' ';
+                out += words[rng.below(sizeof(words) / sizeof(words[0]))];
+            }
+            out += '"';
+        }
+
+        inline void shortName(std::string &out, Random &rng)
+        {
+            out += (char)('a' + rng.below(26));
+        }
+
+        inline void line(std::string &out, Kind kind, Random &rng)
+        {
+            static const char *const ops[] = {" + ", " - ", " * ", " / ", " % "};
+            static const char *const cmps[] = {" < ", " > ", " <= ", " >= ", " == ", " != "};
+
+            switch (kind)
+            {
+            case Kind::Ident:
+                switch (rng.below(3))
+                {
+                case 0:
+                    out += "int ";
+                    identifier(out, rng);
+                    break;
+                case 1:
+                    identifier(out, rng);
+                    out += " = ";
+                    identifier(out, rng);
+                    out += " + ";
+                    identifier(out, rng);
+                    break;
+                default:
+                    identifier(out, rng);
+                    out += " = ";
+                    identifier(out, rng);
+                    out += '(';
+                    identifier(out, rng);
+                    out += ", ";
+                    identifier(out, rng);
+                    out += ')';
+                    break;
+                }
+                out += ";\n";
+                break;
+
+            case Kind::Numeric:
+                out += "value = ";
+                number(out, rng);
+                for (uint32_t i = 0, n = 2 + rng.below(5); i < n; ++i)
+                {
+                    out += ops[rng.below(4)];
+                    number(out, rng);
+                }
+                out += ";\n";
+                break;
+
+            case Kind::String:
+                if (rng.below(2))
+                {
+                    out += "print(";
+                    text(out, rng);
+                    out += ");\n";
+                }
+                else
+                {
+                    out += "message = ";
+                    text(out, rng);
+                    out += ";\n";
+                }
+                break;
+
+            case Kind::Operator:
+                if (rng.below(3) == 0)
+                {
+                    out += "if (";
+                    shortName(out, rng);
+                    out += cmps[rng.below(6)];
+                    shortName(out, rng);
+                    out += ") { ";
+                    shortName(out, rng);
+                    out += " = ";
+                    shortName(out, rng);
+                    out += "[";
+                    shortName(out, rng);
+                    out += "]; }\n";
+                }
+                else
+                {
+                    shortName(out, rng);
+                    out += " = (";
+                    shortName(out, rng);
+                    out += ops[rng.below(5)];
+                    shortName(out, rng);
+                    out += ")";
+                    out += ops[rng.below(5)];
+                    out += "(";
+                    shortName(out, rng);
+                    out += ops[rng.below(5)];
+                    shortName(out, rng);
+                    out += ");\n";
+                }
+                break;
+            }
+        }
+    }
+
+    // Gera pelo menos `bytes` bytes de código (termina sempre em uma linha completa)
+    inline std::string generate(Kind kind, size_t bytes, uint64_t seed = 2025)
+    {
+        Random rng(seed + (uint64_t)kind);
+        std::string out;
+        out.reserve(bytes + 256);
+        while (out.size() < bytes)
+        {
+            detail::line(out, kind, rng);
+        }
+        return out;
+    }
+}
+
+#endif
@@ -0,0 +1,164 @@
+/**
+ * @brief Benchmark da AST em vetores (FlatAST) contra a hierarquia de classes.
+ *
+ * Tokeniza e analisa o arquivo uma única vez e mede, nas duas representações,
+ * a análise semântica (`checkType`, com uma tabela de símbolos nova a cada
+ * execução) e a geração do TAC (`genCode`, com um CodeGenerator novo). A cópia
+ * para a FlatAST é medida à parte. Os tempos são o melhor de N execuções.
+ *
+ * As falhas de cache vêm do contador de hardware do kernel (perf_event_open,
+ * PERF_COUNT_HW_CACHE_MISSES), somadas nas N execuções; sem acesso a ele
+ * (máquina virtual, perf_event_paranoid), aparecem como "indisponível". O
+ * tamanho ocupado pelos nós em cada representação é mostrado sempre.
+ *
+ * Uso: ./bench/flat_ast_bench <arquivo.convcc> [repetições]
+ */
+
+#include <chrono>
+#include <cstring>
+#include <functional>
+#include <iostream>
+#include <string>
+
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+#include "common.hpp"
+
+#include "flat_ast.hpp"
+
+// Contador de falhas de cache desta thread; inválido se o kernel não o oferecer
+class CacheMissCounter
+{
+public:
+    CacheMissCounter()
+    {
+        perf_event_attr attr;
+        std::memset(&attr, 0, sizeof(attr));
+        attr.size = sizeof(attr);
+        attr.type = PERF_TYPE_HARDWARE;
+        attr.config = PERF_COUNT_HW_CACHE_MISSES;
+        attr.disabled = 1;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv = 1;
+        fd = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0);
+    }
+    ~CacheMissCounter()
+    {
+        if (fd >= 0)
+            close(fd);
+    }
+
+    bool valid() const { return fd >= 0; }
+    void start()
+    {
+        if (fd >= 0)
+        {
+            ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+            ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+        }
+    }
+    long long stop()
+    {
+        long long count = 0;
+        if (fd >= 0)
+        {
+            ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+            if (read(fd, &count, sizeof(count)) != sizeof(count))
+                count = 0;
+        }
+        return count;
+    }
+
+private:
+    int fd;
+};
+
+struct Measure
+{
+    double best = 1e30;
+    long long misses = 0;
+};
+
+// Melhor tempo de `repeat` execuções de `run`, com as falhas de cache somadas
+static Measure measure(unsigned repeat, CacheMissCounter &counter, const std::function<void()> &run)
+{
+    Measure m;
+    for (unsigned r = 0; r < repeat; ++r)
+    {
+        counter.start();
+        auto t0 = std::chrono::steady_clock::now();
+        run();
+        auto t1 = std::chrono::steady_clock::now();
+        m.misses += counter.stop();
+        m.best = std::min(m.best, std::chrono::duration<double>(t1 - t0).count());
+    }
+    return m;
+}
+
+static void report(const char *label, const Measure &m, bool counted)
+{
+    std::cout << label << m.best * 1e3 << " ms, falhas de cache: ";
+    if (counted)
+        std::cout << m.misses;
+    else
+        std::cout << "indisponível";
+    std::cout << "\n";
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        std::cerr << "Uso: ./bench/flat_ast_bench <arquivo.convcc> [repetições]\n";
+        return 1;
+    }
+
+    bench::ParsedFile file;
+    if (!bench::load(argv[1], file))
+        return 1;
+    unsigned repeat = bench::repeatArg(argc, argv, 2, 5);
+    ASTNode &root = *file.root();
+
+    // As mensagens de erro semântico não interessam aqui
+    bench::NullBuffer null;
+    std::streambuf *cerrBuf = std::cerr.rdbuf(&null);
+    CacheMissCounter counter;
+    FlatAST flat;
+    Measure build = measure(repeat, counter, [&]()
+                            { flat.build(root); });
+    Measure treeCheck = measure(repeat, counter, [&]()
+                                {
+                                    SymbolTable symtab;
+                                    root.checkType(symtab, false);
+                                });
+    Measure flatCheck = measure(repeat, counter, [&]()
+                                {
+                                    SymbolTable symtab;
+                                    flat.checkType(symtab);
+                                });
+    Measure treeGen = measure(repeat, counter, [&]()
+                              {
+                                  CodeGenerator gen;
+                                  root.genCode(gen);
+                              });
+    Measure flatGen = measure(repeat, counter, [&]()
+                              {
+                                  CodeGenerator gen;
+                                  flat.genCode(gen);
+                              });
+    std::cerr.rdbuf(cerrBuf);
+
+    bool counted = counter.valid();
+    std::cout << "nós:                   " << flat.size() << "\n";
+    std::cout << "bytes (hierarquia):    " << file.arena.bytesUsed() << "\n";
+    std::cout << "bytes (FlatAST):       " << flat.bytesUsed() << "\n";
+    report("cópia para FlatAST:    ", build, counted);
+    report("checkType hierarquia:  ", treeCheck, counted);
+    report("checkType FlatAST:     ", flatCheck, counted);
+    report("genCode hierarquia:    ", treeGen, counted);
+    report("genCode FlatAST:       ", flatGen, counted);
+    return 0;
+}
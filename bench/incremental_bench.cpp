@@ -0,0 +1,160 @@
+/**
+ * @brief Benchmark da análise incremental (IncrementalParser).
+ *
+ * Gera um programa com o número de linhas pedido (funções de 13 linhas, cada
+ * uma seguida de uma variável global e de uma chamada) e mede:
+ * - a análise completa do programa editado: Lexer + `Parser::parse` (AST,
+ *   impressão e TAC, como no compilador) e Lexer + `Parser::buildTree` (só a AST);
+ * - a latência de `IncrementalParser::edit` editando uma única função no meio do
+ *   programa: inserir um comando no corpo, removê-lo e trocar uma constante.
+ *
+ * No fim, a AST incremental é comparada com a de uma análise completa do texto
+ * final (saída de `print`); qualquer diferença encerra com código 1. A saída do
+ * parser é descartada, e cada tempo completo é o melhor de 3 execuções.
+ *
+ * Uso: ./bench/incremental_bench [linhas] [edições]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "common.hpp"
+
+#include "incremental_parser.hpp"
+
+static double since(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+}
+
+static std::string generate(size_t lines)
+{
+    std::ostringstream out;
+    size_t written = 0;
+    for (size_t n = 0; written < lines; ++n, written += 15)
+    {
+        out << "def func_" << n << "(int a_" << n << ", int b_" << n << ") {\n"
+            << "    int acc_" << n << " = 0;\n"
+            << "    float ratio_" << n << " = 1.5;\n"
+            << "    string label_" << n << " = \"bloco\";\n"
+            << "    for (int i_" << n << " = 0; i_" << n << " < a_" << n << "; i_" << n << " = i_" << n << " + 1) {\n"
+            << "        acc_" << n << " = acc_" << n << " + i_" << n << " * b_" << n << " - (a_" << n << " % 7);\n"
+            << "        if (acc_" << n << " > 1000) {\n"
+            << "            break;\n"
+            << "        }\n"
+            << "    }\n"
+            << "    print(acc_" << n << ");\n"
+            << "    return acc_" << n << ";\n"
+            << "}\n"
+            << "int result_" << n << ";\n"
+            << "result_" << n << " = func_" << n << "(" << n % 97 << ", " << n % 13 << ");\n";
+    }
+    return out.str();
+}
+
+// Análise completa, como no compilador; devolve o tempo em ms
+static double fullParse(const std::string &source, bool buildOnly)
+{
+    SymbolTable symtab;
+    lineIndex() = LineIndex();
+    auto start = std::chrono::steady_clock::now();
+    Lexer lexer(source, symtab);
+    TokenBuffer tokens = TokenBuffer::lexAll(lexer, source);
+    Parser parser(tokens);
+    if (buildOnly)
+        parser.buildTree();
+    else
+        parser.parse();
+    return since(start);
+}
+
+static std::string dump(const ProgramNode *program)
+{
+    std::ostringstream out;
+    std::streambuf *old = std::cout.rdbuf(out.rdbuf());
+    if (program)
+        program->print();
+    std::cout.rdbuf(old);
+    return out.str();
+}
+
+int main(int argc, char **argv)
+{
+    size_t lines = argc > 1 ? std::strtoul(argv[1], nullptr, 10) : 100000;
+    size_t rounds = argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 30;
+    std::string source = generate(lines);
+    size_t functions = (lines + 14) / 15;
+
+    bench::NullBuffer null;
+    std::streambuf *coutBuf = std::cout.rdbuf(&null);
+
+    double parseMs = 1e30, buildMs = 1e30;
+    for (int i = 0; i < 3; ++i)
+    {
+        parseMs = std::min(parseMs, fullParse(source, false));
+        buildMs = std::min(buildMs, fullParse(source, true));
+    }
+
+    IncrementalParser incremental;
+    auto start = std::chrono::steady_clock::now();
+    bool ok = incremental.parse(source);
+    double initialMs = since(start);
+
+    // Cada rodada edita uma função diferente perto do meio do programa
+    std::vector<double> latencies;
+    IncrementalParser::Stats typical;
+    for (size_t r = 0; r < rounds && ok; ++r)
+    {
+        size_t n = functions / 2 + r;
+        std::string id = std::to_string(n);
+        const std::string &text = incremental.source();
+
+        std::string anchor = "        if (acc_" + id + " > 1000) {\n";
+        size_t at = text.find(anchor);
+        std::string statement = "        print(i_" + id + ");\n";
+
+        start = std::chrono::steady_clock::now();
+        ok = ok && incremental.edit(at, at, statement);
+        latencies.push_back(since(start));
+        typical = incremental.lastStats();
+
+        start = std::chrono::steady_clock::now();
+        ok = ok && incremental.edit(at, at + statement.size(), "");
+        latencies.push_back(since(start));
+
+        size_t constant = incremental.source().find("1000", at);
+        start = std::chrono::steady_clock::now();
+        ok = ok && incremental.edit(constant, constant + 4, "999");
+        latencies.push_back(since(start));
+        ok = ok && !incremental.lastStats().full;
+    }
+
+    std::string finalText = incremental.source();
+    std::string incrementalTree = dump(incremental.program());
+    IncrementalParser reference;
+    reference.parse(finalText);
+    bool same = ok && incrementalTree == dump(reference.program());
+
+    std::cout.rdbuf(coutBuf);
+    std::sort(latencies.begin(), latencies.end());
+    double median = latencies.empty() ? 0 : latencies[latencies.size() / 2];
+    double worst = latencies.empty() ? 0 : latencies.back();
+    std::cout << "linhas:                      " << lines << " (" << source.size() << " bytes, "
+              << incremental.tokenStream().size() << " tokens, " << functions << " funções)\n";
+    std::cout << "Parser::parse completo:      " << parseMs << " ms (Lexer + AST + impressão + TAC)\n";
+    std::cout << "Parser::buildTree completo:  " << buildMs << " ms (Lexer + AST)\n";
+    std::cout << "IncrementalParser::parse:    " << initialMs << " ms (primeira análise)\n";
+    std::cout << "edit (" << latencies.size() << " edições):        mediana " << median << " ms, pior "
+              << worst << " ms\n";
+    std::cout << "  por edição:                " << typical.relexedTokens << " tokens relidos, "
+              << typical.reparsedDecls << " DECLs reanalisadas, " << typical.reusedDecls << " reaproveitadas\n";
+    std::cout << "aceleração (mediana):        " << parseMs / median << "x sobre Parser::parse, "
+              << buildMs / median << "x sobre Parser::buildTree\n";
+    std::cout << "AST incremental == completa: " << (same ? "sim" : "NÃO") << "\n";
+    return same ? 0 : 1;
+}
@@ -0,0 +1,110 @@
+/**
+ * @brief Benchmark da classificação identificador/palavra-chave.
+ *
+ * Extrai todas as palavras ([a-zA-Z_][a-zA-Z0-9_]*) de um arquivo .convcc e mede
+ * o tempo para classificá-las com a cadeia de comparações usada antes em
+ * `Lexer::identifier` e com a tabela de hash perfeito de `keywords::lookup`.
+ *
+ * Uso: ./bench/keyword_bench <arquivo.convcc> [repetições]
+ */
+
+#include <cctype>
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "keywords.hpp"
+
+// Referência: cadeia de comparações original
+static TokenType chainLookup(std::string_view value)
+{
+    if (value == "int") return TokenType::KW_INT;
+    if (value == "float") return TokenType::KW_FLOAT;
+    if (value == "string") return TokenType::KW_STRING;
+    if (value == "def") return TokenType::KW_DEF;
+    if (value == "for") return TokenType::KW_FOR;
+    if (value == "if") return TokenType::KW_IF;
+    if (value == "else") return TokenType::KW_ELSE;
+    if (value == "return") return TokenType::KW_RETURN;
+    if (value == "break") return TokenType::KW_BREAK;
+    if (value == "print") return TokenType::KW_PRINT;
+    if (value == "read") return TokenType::KW_READ;
+    if (value == "new") return TokenType::KW_NEW;
+    if (value == "null") return TokenType::KW_NULL;
+    return TokenType::IDENT;
+}
+
+template <typename F>
+static double run(const std::vector<std::string_view> &words, int reps, F lookup, size_t &keywordCount)
+{
+    keywordCount = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int r = 0; r < reps; ++r)
+    {
+        for (auto w : words)
+        {
+            if (lookup(w) != TokenType::IDENT)
+                ++keywordCount;
+        }
+    }
+    auto end = std::chrono::steady_clock::now();
+    return std::chrono::duration<double>(end - start).count();
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        std::cerr << "Uso: ./bench/keyword_bench <arquivo.convcc> [repetições]\n";
+        return 1;
+    }
+
+    std::ifstream f(argv[1]);
+    if (!f)
+    {
+        std::cerr << "Erro: não foi possível abrir o arquivo '" << argv[1] << "'\n";
+        return 1;
+    }
+    std::stringstream buffer;
+    buffer << f.rdbuf();
+    std::string src = buffer.str();
+    int reps = argc > 2 ? std::atoi(argv[2]) : 200;
+
+    std::vector<std::string_view> words;
+    for (size_t i = 0; i < src.size();)
+    {
+        if (isalpha((unsigned char)src[i]) || src[i] == '_')
+        {
+            size_t start = i;
+            while (i < src.size() && (isalnum((unsigned char)src[i]) || src[i] == '_'))
+                ++i;
+            words.push_back(std::string_view(src).substr(start, i - start));
+        }
+        else
+        {
+            ++i;
+        }
+    }
+
+    size_t kwChain = 0, kwHash = 0;
+    double tChain = run(words, reps, chainLookup, kwChain);
+    double tHash = run(words, reps, keywords::lookup, kwHash);
+
+    if (kwChain != kwHash)
+    {
+        std::cerr << "Erro: resultados divergentes (" << kwChain << " vs " << kwHash << ")\n";
+        return 1;
+    }
+
+    double total = (double)words.size() * reps;
+    std::cout << "palavras:            " << words.size() << " x " << reps << "\n";
+    std::cout << "palavras-chave:      " << kwHash / reps << "\n";
+    std::cout << "cadeia (ns/palavra): " << tChain * 1e9 / total << "\n";
+    std::cout << "hash   (ns/palavra): " << tHash * 1e9 / total << "\n";
+    return 0;
+}
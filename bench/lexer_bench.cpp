@@ -0,0 +1,217 @@
+/**
+ * @brief Microbenchmark do analisador léxico.
+ *
+ * Lê um arquivo .convcc (replicando-o até atingir o tamanho pedido) e executa
+ * `Lexer::nextToken` até o fim do arquivo, reportando tempo, tokens e número
+ * de alocações de heap por token. As alocações são contadas substituindo o
+ * `operator new` global.
+ *
+ * Com `--suite`, usa os corpora sintéticos de `corpus.hpp` (identificadores,
+ * números, strings e operadores) em vários tamanhos, reporta MB/s, tokens/s e
+ * alocações por token de cada um e, opcionalmente, grava os resultados em JSON
+ * para comparação entre commits (ver `make bench-lexer`). O tempo é o melhor de
+ * `--repeat` execuções; as alocações são as da primeira (o Interner é global,
+ * então as seguintes encontram os nomes já internados).
+ *
+ * Uso: ./bench/lexer_bench <arquivo.convcc> [tamanho_em_MB]
+ *      ./bench/lexer_bench --suite [--sizes=1,10,100] [--repeat=3]
+ *                          [--json=<arquivo>] [--label=<texto>]
+ */
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#define BENCH_COUNT_ALLOCATIONS
+#include "common.hpp"
+#include "corpus.hpp"
+
+#include "lexer.hpp"
+#include "scan.hpp"
+#include "line_index.hpp"
+#include "symbol_table.hpp"
+
+struct Measurement
+{
+    size_t tokens = 0;
+    size_t allocs = 0;
+    double seconds = 0;
+};
+
+static Measurement lexOnce(const std::string &source)
+{
+    Measurement m;
+    lineIndex() = LineIndex();
+    SymbolTable symtab;
+    Lexer lex(source, symtab);
+
+    size_t allocsBefore = allocCount;
+    auto start = std::chrono::steady_clock::now();
+
+    for (;;)
+    {
+        Token tok = lex.nextToken();
+        if (tok.type == TokenType::END_OF_FILE || tok.type == TokenType::ERROR)
+            break;
+        ++m.tokens;
+    }
+
+    auto end = std::chrono::steady_clock::now();
+    m.allocs = allocCount - allocsBefore;
+    m.seconds = std::chrono::duration<double>(end - start).count();
+    return m;
+}
+
+static int runFile(int argc, char **argv)
+{
+    std::ifstream f(argv[1]);
+    if (!f)
+    {
+        std::cerr << "Erro: não foi possível abrir o arquivo '" << argv[1] << "'\n";
+        return 1;
+    }
+    std::stringstream buffer;
+    buffer << f.rdbuf();
+    std::string unit = buffer.str();
+
+    size_t targetBytes = (argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 10) * 1024 * 1024;
+    std::string source;
+    source.reserve(targetBytes + unit.size());
+    while (source.size() < targetBytes)
+    {
+        source += unit;
+        source += '\n';
+    }
+
+    Measurement m = lexOnce(source);
+    double mb = source.size() / (1024.0 * 1024.0);
+
+    std::cout << "varredura:      " << scan::implementation() << "\n";
+    std::cout << "bytes:          " << source.size() << "\n";
+    std::cout << "tokens:         " << m.tokens << "\n";
+    std::cout << "tempo (s):      " << m.seconds << "\n";
+    std::cout << "MB/s:           " << mb / m.seconds << "\n";
+    std::cout << "alocações:      " << m.allocs << "\n";
+    std::cout << "alocações/token: " << (m.tokens ? (double)m.allocs / m.tokens : 0.0) << "\n";
+    return 0;
+}
+
+static std::string jsonEscape(const std::string &text)
+{
+    std::string out;
+    for (char c : text)
+    {
+        if (c == '"' || c == '\\')
+            out += '\\';
+        out += c;
+    }
+    return out;
+}
+
+static int runSuite(int argc, char **argv)
+{
+    std::vector<size_t> sizes{1, 10, 100};
+    unsigned repeat = 3;
+    std::string jsonPath, label;
+
+    for (int i = 2; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg.rfind("--sizes=", 0) == 0)
+        {
+            sizes.clear();
+            std::stringstream list(arg.substr(8));
+            std::string item;
+            while (std::getline(list, item, ','))
+                sizes.push_back(std::strtoul(item.c_str(), nullptr, 10));
+        }
+        else if (arg.rfind("--repeat=", 0) == 0)
+            repeat = std::max(1ul, std::strtoul(arg.c_str() + 9, nullptr, 10));
+        else if (arg.rfind("--json=", 0) == 0)
+            jsonPath = arg.substr(7);
+        else if (arg.rfind("--label=", 0) == 0)
+            label = arg.substr(8);
+        else
+        {
+            std::cerr << "Erro: opção desconhecida '" << arg << "'\n";
+            return 1;
+        }
+    }
+
+    std::ostringstream json;
+    json << "{\n  \"label\": \"" << jsonEscape(label) << "\",\n"
+         << "  \"scan\": \"" << scan::implementation() << "\",\n"
+         << "  \"results\": [";
+
+    std::cout << "varredura: " << scan::implementation() << "\n";
+    std::cout << "corpus     MB        tokens      MB/s    Mtokens/s  alocações/token\n";
+
+    bool first = true;
+    for (corpus::Kind kind : corpus::allKinds())
+    {
+        for (size_t mbTarget : sizes)
+        {
+            std::string source = corpus::generate(kind, mbTarget * 1024 * 1024);
+            double mb = source.size() / (1024.0 * 1024.0);
+
+            Measurement best = lexOnce(source);
+            size_t allocs = best.allocs;
+            for (unsigned r = 1; r < repeat; ++r)
+            {
+                Measurement m = lexOnce(source);
+                if (m.seconds < best.seconds)
+                    best = m;
+            }
+
+            double mbPerSec = mb / best.seconds;
+            double tokensPerSec = best.tokens / best.seconds;
+            double allocsPerToken = best.tokens ? (double)allocs / best.tokens : 0.0;
+
+            std::printf("%-9s %4zu %13zu %9.1f %12.2f %16.6f\n", corpus::name(kind), mbTarget,
+                        best.tokens, mbPerSec, tokensPerSec / 1e6, allocsPerToken);
+
+            json << (first ? "\n" : ",\n")
+                 << "    {\"corpus\": \"" << corpus::name(kind) << "\", \"size_mb\": " << mbTarget
+                 << ", \"bytes\": " << source.size() << ", \"tokens\": " << best.tokens
+                 << ", \"seconds\": " << best.seconds << ", \"mb_per_s\": " << mbPerSec
+                 << ", \"tokens_per_s\": " << tokensPerSec
+                 << ", \"allocs_per_token\": " << allocsPerToken << "}";
+            first = false;
+        }
+    }
+    json << "\n  ]\n}\n";
+
+    if (!jsonPath.empty())
+    {
+        std::ofstream out(jsonPath);
+        if (!out)
+        {
+            std::cerr << "Erro ao criar arquivo de resultados: " << jsonPath << "\n";
+            return 1;
+        }
+        out << json.str();
+        std::cout << "resultados em " << jsonPath << "\n";
+    }
+    return 0;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        std::cerr << "Uso: ./bench/lexer_bench <arquivo.convcc> [tamanho_em_MB]\n";
+        std::cerr << "     ./bench/lexer_bench --suite [--sizes=1,10,100] [--repeat=3] "
+                     "[--json=<arquivo>] [--label=<texto>]\n";
+        return 1;
+    }
+
+    if (std::string(argv[1]) == "--suite")
+        return runSuite(argc, argv);
+    return runFile(argc, argv);
+}
@@ -0,0 +1,94 @@
+/**
+ * @brief Benchmark de escalabilidade da análise léxica paralela.
+ *
+ * Lê um arquivo .convcc (replicando-o até atingir o tamanho pedido), executa a
+ * análise serial (`TokenBuffer::lexAll`) e depois `lexParallel` com 1, 2, 4, 8 e
+ * 16 threads, reportando tempo, MB/s e aceleração em relação à serial. Cada
+ * fluxo paralelo é comparado token a token com o serial.
+ *
+ * Uso: ./bench/parallel_lexer_bench <arquivo.convcc> [tamanho_em_MB]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "lexer.hpp"
+#include "parallel_lexer.hpp"
+#include "symbol_table.hpp"
+#include "token_buffer.hpp"
+
+static bool sameStream(const TokenBuffer &a, const TokenBuffer &b)
+{
+    if (a.size() != b.size())
+        return false;
+    for (size_t i = 0; i < a.size(); ++i)
+    {
+        Token x = a.get(i);
+        Token y = b.get(i);
+        if (x.type != y.type || x.lexeme != y.lexeme || x.offset != y.offset)
+            return false;
+    }
+    return true;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        std::cerr << "Uso: ./bench/parallel_lexer_bench <arquivo.convcc> [tamanho_em_MB]\n";
+        return 1;
+    }
+
+    std::ifstream f(argv[1]);
+    if (!f)
+    {
+        std::cerr << "Erro: não foi possível abrir o arquivo '" << argv[1] << "'\n";
+        return 1;
+    }
+    std::stringstream buffer;
+    buffer << f.rdbuf();
+    std::string unit = buffer.str();
+
+    size_t targetBytes = (argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 50) * 1024 * 1024;
+    std::string source;
+    source.reserve(targetBytes + unit.size());
+    while (source.size() < targetBytes)
+    {
+        source += unit;
+        source += '\n';
+    }
+    double mb = source.size() / (1024.0 * 1024.0);
+
+    SymbolTable serialSymtab;
+    Lexer lex(source, serialSymtab);
+    auto start = std::chrono::steady_clock::now();
+    TokenBuffer serial = TokenBuffer::lexAll(lex, source);
+    double serialSecs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    std::cout << "núcleos:        " << std::thread::hardware_concurrency() << "\n";
+    std::cout << "bytes:          " << source.size() << "\n";
+    std::cout << "tokens:         " << serial.size() << "\n";
+    std::cout << "serial:         " << serialSecs << " s, " << mb / serialSecs << " MB/s\n";
+
+    bool ok = true;
+    for (unsigned threads : {1u, 2u, 4u, 8u, 16u})
+    {
+        SymbolTable symtab;
+        LineIndex lines;
+        start = std::chrono::steady_clock::now();
+        TokenBuffer tokens = lexParallel(source, symtab, lines, threads);
+        double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        bool same = sameStream(serial, tokens) && lines.lineCount() == lineIndex().lineCount();
+        ok = ok && same;
+        std::cout << "threads=" << threads << (threads < 10 ? ":      " : ":     ")
+                  << secs << " s, " << mb / secs << " MB/s, aceleração "
+                  << serialSecs / secs << "x" << (same ? "" : "  [FLUXO DIFERENTE]") << "\n";
+    }
+    return ok ? 0 : 1;
+}
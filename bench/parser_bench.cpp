@@ -0,0 +1,124 @@
+/**
+ * @brief Benchmark do analisador sintático LL(1).
+ *
+ * Tokeniza o arquivo uma única vez (TokenBuffer) e mede separadamente a
+ * construção do parser, o laço LL(1) com as ações semânticas
+ * (`Parser::buildTree`) e `Parser::parse` completo, que também imprime a AST e
+ * gera o código intermediário; a saída é descartada. O tempo é o melhor de N
+ * execuções.
+ *
+ * As alocações são contadas substituindo o `operator new` global. No laço
+ * LL(1), a pilha de análise e a pilha semântica não alocam depois de aquecidas,
+ * e os nós da AST e as listas de filhos vão para a Arena do parser: o que resta
+ * são os blocos da Arena. A destruição do parser (que libera a AST inteira)
+ * também é cronometrada.
+ *
+ * Com --parser=rd, mede o backend de descida recursiva no lugar do laço LL(1);
+ * com --parse-threads=N, inclui na construção da AST a análise paralela das
+ * funções (ver src/parallel_parser.cpp).
+ *
+ * Uso: ./bench/parser_bench [--parser=rd] [--parse-threads=N] <arquivo.convcc> [repetições]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#define BENCH_COUNT_ALLOCATIONS
+#include "common.hpp"
+
+#include "ast_visitor.hpp"
+
+static size_t countNodes(ASTNode *root)
+{
+    size_t count = 0;
+    walkTree(*root, [&count](ASTNode &) { ++count; });
+    return count;
+}
+
+int main(int argc, char **argv)
+{
+    ParserBackend backend = ParserBackend::Table;
+    unsigned parseThreads = 1;
+    while (argc > 1 && std::string(argv[1]).rfind("--", 0) == 0)
+    {
+        std::string arg = argv[1];
+        if (arg == "--parser=rd")
+            backend = ParserBackend::Descent;
+        else if (arg.rfind("--parse-threads=", 0) == 0)
+            parseThreads = (unsigned)std::strtoul(arg.c_str() + std::strlen("--parse-threads="), nullptr, 10);
+        --argc;
+        ++argv;
+    }
+    if (argc < 2)
+    {
+        std::cerr << "Uso: ./bench/parser_bench [--parser=rd] [--parse-threads=N] <arquivo.convcc> [repetições]\n";
+        return 1;
+    }
+
+    bench::ParsedFile file;
+    if (!bench::load(argv[1], file, false))
+        return 1;
+    unsigned repeat = bench::repeatArg(argc, argv, 2, 3);
+    const TokenBuffer &tokens = file.tokens;
+
+    bench::NullBuffer null;
+    std::streambuf *coutBuf = std::cout.rdbuf(&null);
+
+    double bestSetup = 1e30, bestTree = 1e30, bestParse = 1e30, bestTeardown = 1e30;
+    size_t treeAllocs = 0, parseAllocs = 0, nodes = 0;
+    for (unsigned r = 0; r < repeat; ++r)
+    {
+        auto t0 = std::chrono::steady_clock::now();
+        auto parser = std::make_unique<Parser>(tokens);
+        parser->setBackend(backend);
+        parser->setParseThreads(parseThreads);
+        auto t1 = std::chrono::steady_clock::now();
+        size_t before = allocCount;
+        parser->buildTree();
+        auto t2 = std::chrono::steady_clock::now();
+        treeAllocs = allocCount - before;
+        if (parser->root)
+            nodes = countNodes(parser->root);
+        auto t3 = std::chrono::steady_clock::now();
+        parser.reset();
+        auto t4 = std::chrono::steady_clock::now();
+
+        bestSetup = std::min(bestSetup, std::chrono::duration<double>(t1 - t0).count());
+        bestTree = std::min(bestTree, std::chrono::duration<double>(t2 - t1).count());
+        bestTeardown = std::min(bestTeardown, std::chrono::duration<double>(t4 - t3).count());
+    }
+    for (unsigned r = 0; r < repeat; ++r)
+    {
+        auto parser = std::make_unique<Parser>(tokens);
+        parser->setBackend(backend);
+        parser->setParseThreads(parseThreads);
+        size_t before = allocCount;
+        auto t0 = std::chrono::steady_clock::now();
+        parser->parse();
+        auto t1 = std::chrono::steady_clock::now();
+        parseAllocs = allocCount - before;
+
+        bestParse = std::min(bestParse, std::chrono::duration<double>(t1 - t0).count());
+    }
+
+    std::cout.rdbuf(coutBuf);
+    double perToken = 1.0 / tokens.size();
+    std::cout << "tokens:                  " << tokens.size() << "\n";
+    std::cout << "nós da AST:              " << nodes << "\n";
+    std::cout << "construção (ms):         " << bestSetup * 1e3 << "\n";
+    const char *tree = backend == ParserBackend::Descent ? "descida   " : "laço LL(1)";
+    std::cout << tree << " (ms):         " << bestTree * 1e3 << "\n";
+    std::cout << tree << " tokens/s:     " << tokens.size() / bestTree << "\n";
+    std::cout << tree << " alocações:    " << treeAllocs << " (" << treeAllocs * perToken << "/token)\n";
+    std::cout << "destruição (ms):         " << bestTeardown * 1e3 << "\n";
+    std::cout << "parse (ms):              " << bestParse * 1e3 << "\n";
+    std::cout << "parse tokens/s:          " << tokens.size() / bestParse << "\n";
+    std::cout << "parse alocações:         " << parseAllocs << " (" << parseAllocs * perToken << "/token)\n";
+    return 0;
+}
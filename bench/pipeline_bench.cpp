@@ -0,0 +1,116 @@
+/**
+ * @brief Benchmark da análise léxica em paralelo com o parser (opção --pipeline).
+ *
+ * Lê um arquivo .convcc (replicando-o até atingir o tamanho pedido) e mede o
+ * tempo de parede de `Parser::buildTree` com o Lexer sob demanda, na mesma
+ * thread, e com o Lexer em uma thread produtora (`TokenPipe`). Para referência,
+ * também mede as duas fases isoladas: o Lexer sozinho (`TokenBuffer::lexAll`) e o
+ * parser sobre o buffer pronto; com dois núcleos livres, o tempo do pipeline
+ * tende ao maior dos dois. A saída do parser é descartada.
+ *
+ * Uso: ./bench/pipeline_bench <arquivo.convcc> [tamanho_em_MB]
+ */
+
+#include <chrono>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <thread>
+
+#include "common.hpp"
+
+#include "token_pipe.hpp"
+
+static double since(std::chrono::steady_clock::time_point start)
+{
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        std::cerr << "Uso: ./bench/pipeline_bench <arquivo.convcc> [tamanho_em_MB]\n";
+        return 1;
+    }
+
+    std::ifstream f(argv[1]);
+    if (!f)
+    {
+        std::cerr << "Erro: não foi possível abrir o arquivo '" << argv[1] << "'\n";
+        return 1;
+    }
+    std::stringstream buffer;
+    buffer << f.rdbuf();
+    std::string unit = buffer.str();
+
+    size_t targetBytes = (argc > 2 ? std::strtoul(argv[2], nullptr, 10) : 50) * 1024 * 1024;
+    std::string source;
+    source.reserve(targetBytes + unit.size());
+    while (source.size() < targetBytes)
+    {
+        source += unit;
+        source += '\n';
+    }
+    double mb = source.size() / (1024.0 * 1024.0);
+
+    bench::NullBuffer null;
+    std::streambuf *coutBuf = std::cout.rdbuf(&null);
+
+    // Fases isoladas
+    SymbolTable lexSymtab;
+    Lexer lexOnly(source, lexSymtab);
+    auto start = std::chrono::steady_clock::now();
+    TokenBuffer tokens = TokenBuffer::lexAll(lexOnly, source);
+    double lexSecs = since(start);
+
+    double parseSecs;
+    {
+        Parser parser(tokens);
+        start = std::chrono::steady_clock::now();
+        parser.buildTree();
+        parseSecs = since(start);
+    }
+
+    // Lexer e parser na mesma thread
+    double serialSecs;
+    bool serialOk;
+    {
+        SymbolTable symtab;
+        Lexer lex(source, symtab);
+        Parser parser(lex);
+        start = std::chrono::steady_clock::now();
+        parser.buildTree();
+        serialSecs = since(start);
+        serialOk = parser.root && !parser.hasErrors();
+    }
+
+    // Lexer em uma thread produtora
+    double pipeSecs;
+    bool pipeOk;
+    {
+        SymbolTable symtab;
+        Lexer lex(source, symtab);
+        start = std::chrono::steady_clock::now();
+        TokenPipe pipe(lex);
+        Parser parser(pipe);
+        parser.buildTree();
+        pipeSecs = since(start);
+        pipeOk = parser.root && !parser.hasErrors();
+    }
+
+    std::cout.rdbuf(coutBuf);
+    std::cout << "núcleos:             " << std::thread::hardware_concurrency() << "\n";
+    std::cout << "bytes:               " << source.size() << " (" << mb << " MB)\n";
+    std::cout << "tokens:              " << tokens.size() << "\n";
+    std::cout << "só o lexer:          " << lexSecs << " s\n";
+    std::cout << "só o parser:         " << parseSecs << " s\n";
+    std::cout << "mesma thread:        " << serialSecs << " s, " << mb / serialSecs << " MB/s"
+              << (serialOk ? "" : "  [ERRO]") << "\n";
+    std::cout << "pipeline:            " << pipeSecs << " s, " << mb / pipeSecs << " MB/s, aceleração "
+              << serialSecs / pipeSecs << "x" << (pipeOk ? "" : "  [ERRO]") << "\n";
+    return serialOk && pipeOk ? 0 : 1;
+}
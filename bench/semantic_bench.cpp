@@ -0,0 +1,52 @@
+/**
+ * @brief Benchmark da análise semântica (`checkType` sobre a AST inteira).
+ *
+ * Tokeniza e analisa o arquivo uma única vez e mede só a verificação de tipos e
+ * escopos, como o compilador a faz depois de imprimir a AST: `checkType` na
+ * raiz, com uma tabela de símbolos nova a cada execução. As mensagens de erro
+ * semântico vão para stderr normalmente. O tempo é o melhor de N execuções; as
+ * alocações são contadas substituindo o `operator new` global.
+ *
+ * Uso: ./bench/semantic_bench <arquivo.convcc> [repetições]
+ */
+
+#include <chrono>
+#include <iostream>
+#include <string>
+
+#define BENCH_COUNT_ALLOCATIONS
+#include "common.hpp"
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        std::cerr << "Uso: ./bench/semantic_bench <arquivo.convcc> [repetições]\n";
+        return 1;
+    }
+
+    bench::ParsedFile file;
+    if (!bench::load(argv[1], file))
+        return 1;
+    unsigned repeat = bench::repeatArg(argc, argv, 2, 5);
+
+    double best = 1e30;
+    size_t allocs = 0;
+    for (unsigned r = 0; r < repeat; ++r)
+    {
+        SymbolTable symtab;
+        size_t before = allocCount;
+        auto t0 = std::chrono::steady_clock::now();
+        file.root()->checkType(symtab, false);
+        auto t1 = std::chrono::steady_clock::now();
+        allocs = allocCount - before;
+        best = std::min(best, std::chrono::duration<double>(t1 - t0).count());
+    }
+
+    std::cout << "tokens:                " << file.tokens.size() << "\n";
+    std::cout << "checkType (ms):        " << best * 1e3 << "\n";
+    std::cout << "checkType tokens/s:    " << file.tokens.size() / best << "\n";
+    std::cout << "checkType alocações:   " << allocs << "\n";
+    std::cout << "erros semânticos:      " << (ASTNode::hasSemanticError ? "sim" : "não") << "\n";
+    return 0;
+}
@@ -0,0 +1,110 @@
+/**
+ * @brief Benchmark de um percurso completo da AST que não faz nada em cada nó.
+ *
+ * Tokeniza e analisa o arquivo uma única vez e percorre a árvore inteira, com
+ * uma pilha explícita, de três formas:
+ *
+ * - std::function: `forEachChild` entregando cada filho por um
+ *   `std::function<void(ASTNode &)>`, como fazia o antigo método virtual
+ *   `ASTNode::forEachChild` (a chamada virtual por nó já não existe);
+ * - forEachChild: `walkTree` com um lambda, despachado pelo `kind`;
+ * - ASTVisitor: `walkTree` chamando, em cada nó, um visitante (ver
+ *   ast_visitor.hpp) que conta os nós de cada tipo.
+ *
+ * Os tempos são o melhor de N execuções.
+ *
+ * Uso: ./bench/visitor_bench <arquivo.convcc> [repetições]
+ */
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "common.hpp"
+
+#include "ast_visitor.hpp"
+
+// Conta os nós de cada tipo; todos os visitX caem em visitNode
+class KindCounter : public ASTVisitor<KindCounter>
+{
+public:
+    size_t counts[(size_t)NodeKind::ArrayAssign + 1] = {};
+
+    void visitNode(ASTNode &node) { ++counts[(size_t)node.kind]; }
+};
+
+// Melhor tempo, em ms, de `repeat` execuções de `run`
+template <typename F>
+static double measure(unsigned repeat, F &&run)
+{
+    double best = 1e30;
+    for (unsigned r = 0; r < repeat; ++r)
+    {
+        auto t0 = std::chrono::steady_clock::now();
+        run();
+        auto t1 = std::chrono::steady_clock::now();
+        best = std::min(best, std::chrono::duration<double>(t1 - t0).count());
+    }
+    return best * 1e3;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2)
+    {
+        std::cerr << "Uso: ./bench/visitor_bench <arquivo.convcc> [repetições]\n";
+        return 1;
+    }
+
+    bench::ParsedFile file;
+    if (!bench::load(argv[1], file))
+        return 1;
+    unsigned repeat = bench::repeatArg(argc, argv, 2, 10);
+    ASTNode &root = *file.root();
+
+    size_t erased = 0;
+    double erasedTime = measure(repeat, [&]()
+                                {
+                                    erased = 0;
+                                    std::vector<ASTNode *> pending{&root};
+                                    std::function<void(ASTNode &)> push = [&pending](ASTNode &child)
+                                    { pending.push_back(&child); };
+                                    while (!pending.empty())
+                                    {
+                                        ASTNode *node = pending.back();
+                                        pending.pop_back();
+                                        ++erased;
+                                        forEachChild(*node, push);
+                                    }
+                                });
+
+    size_t walked = 0;
+    double walkTime = measure(repeat, [&]()
+                              {
+                                  walked = 0;
+                                  walkTree(root, [&walked](ASTNode &) { ++walked; });
+                              });
+
+    KindCounter counter;
+    double visitorTime = measure(repeat, [&]()
+                                 {
+                                     counter = KindCounter();
+                                     walkTree(root, [&counter](ASTNode &node) { counter.visit(node); });
+                                 });
+    size_t visited = 0;
+    for (size_t count : counter.counts)
+        visited += count;
+
+    if (erased != walked || walked != visited)
+    {
+        std::cerr << "Erro: os percursos visitaram quantidades diferentes de nós\n";
+        return 1;
+    }
+    std::cout << "nós:              " << walked << "\n";
+    std::cout << "std::function:    " << erasedTime << " ms\n";
+    std::cout << "forEachChild:     " << walkTime << " ms\n";
+    std::cout << "ASTVisitor:       " << visitorTime << " ms\n";
+    return 0;
+}
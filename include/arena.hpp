@@ -0,0 +1,97 @@
+#ifndef ARENA_HPP
+#define ARENA_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Alocador por incremento de ponteiro que guarda todos os nós da AST de
+ * uma compilação.
+ *
+ * A memória vem em blocos grandes; cada pedido só avança um cursor dentro do
+ * bloco atual. Nada é liberado individualmente: os blocos são devolvidos todos
+ * de uma vez quando a Arena é destruída, ou reaproveitados depois de reset().
+ *
+ * Os destrutores dos objetos criados aqui nunca são chamados. Por isso a Arena
+ * só deve guardar objetos cuja memória própria também esteja nela (listas com
+ * ArenaAllocator), ou que não tenham memória própria.
+ */
+class Arena
+{
+public:
+    static constexpr size_t BlockSize = 64 * 1024;
+
+    void *allocate(size_t size, size_t align)
+    {
+        size_t padding = (size_t)(-(uintptr_t)cursor) & (align - 1);
+        if (size + padding > remaining)
+            return allocateSlow(size, align);
+        char *p = cursor + padding;
+        cursor = p + size;
+        remaining -= size + padding;
+        used += size + padding;
+        return p;
+    }
+
+    template <typename T, typename... Args>
+    T *make(Args &&...args)
+    {
+        return new (allocate(sizeof(T), alignof(T))) T(std::forward<Args>(args)...);
+    }
+
+    // Descarta todos os objetos; os blocos comuns ficam para as próximas alocações
+    void reset();
+
+    // Bytes entregues desde a criação (ou o último reset) e blocos reservados
+    size_t bytesUsed() const { return used; }
+    size_t blockCount() const { return blocks.size() + large.size(); }
+
+private:
+    std::vector<std::unique_ptr<char[]>> blocks; // de BlockSize bytes
+    std::vector<std::unique_ptr<char[]>> large;  // pedidos maiores que um quarto de bloco
+    size_t nextBlock = 0;                        // próximo bloco de `blocks` a usar
+    char *cursor = nullptr;
+    size_t remaining = 0;
+    size_t used = 0;
+
+    void *allocateSlow(size_t size, size_t align);
+};
+
+/**
+ * @brief Alocador padrão (std::allocator_traits) sobre uma Arena, para as listas
+ * de filhos dos nós. `deallocate` não faz nada: ao crescer, a lista deixa o
+ * espaço antigo na Arena, então convém reservar o tamanho final quando ele é
+ * conhecido.
+ */
+template <typename T>
+class ArenaAllocator
+{
+public:
+    using value_type = T;
+
+    explicit ArenaAllocator(Arena &arena) : arena(&arena) {}
+    template <typename U>
+    ArenaAllocator(const ArenaAllocator<U> &other) : arena(other.arena) {}
+
+    T *allocate(size_t n) { return static_cast<T *>(arena->allocate(n * sizeof(T), alignof(T))); }
+    void deallocate(T *, size_t) {}
+
+    template <typename U>
+    bool operator==(const ArenaAllocator<U> &other) const { return arena == other.arena; }
+    template <typename U>
+    bool operator!=(const ArenaAllocator<U> &other) const { return arena != other.arena; }
+
+private:
+    template <typename U>
+    friend class ArenaAllocator;
+    Arena *arena;
+};
+
+template <typename T>
+using ArenaVector = std::vector<T, ArenaAllocator<T>>;
+
+#endif
@@ -1,10 +1,11 @@
 #ifndef AST_HPP
 #define AST_HPP
 
+#include <cstdint>
 #include <string>
+#include <string_view>
 #include <vector>
-#include <memory>
-#include <iostream>
+#include "arena.hpp"
 #include "symbol_table.hpp"
 #include "code_generator.hpp"
 
@@ -26,13 +27,22 @@ class StmtNode;
  * - Estruturas de Alto Nível: `ProgramNode` e `FuncDefNode`.
  *
  * --- FUNCIONALIDADES IMPLEMENTADAS NOS NÓS ---
+ * Os métodos `print`, `checkType` e `genCode` de `ASTNode` (em src/ast.cpp) escolhem o que
+ * fazer em cada nó pelo `kind`. `print` e `checkType` guardam os nós em andamento em uma pilha
+ * própria, sem recursão; `genCode` é recursiva nos primeiros `passes::RecursionDepth` (256)
+ * níveis e continua abaixo deles com uma pilha própria. Assim, blocos aninhados ou cadeias
+ * `a + b + c + ...` de qualquer profundidade não estouram a pilha nativa.
+ * As regras de `checkType` e `genCode` ficam em ast_passes.hpp e valem também para a FlatAST.
+ * Passadas novas não acrescentam métodos às classes: são visitantes (`ASTVisitor`, em
+ * ast_visitor.hpp), que também oferece `forEachChild` e `walkTree` para percorrer os filhos.
  *
  * 1. Visualização da Árvore (Método `print`):
- * - Percorre a árvore recursivamente imprimindo a estrutura indentada.
+ * - Percorre a árvore em pré-ordem imprimindo a estrutura indentada.
  *
  * 2. Análise Semântica (Método `checkType`):
- * - Cada nó é responsável por validar a si mesmo.
+ * - Cada tipo de nó tem a sua regra de validação.
  * - Validação de Tipos: Garante que operações aritméticas e atribuições sejam compatíveis (ex: não somar string com int).
+ * Os tipos são `TypeId`s (ver types.hpp): compará-los é comparar inteiros.
  * - Gerenciamento de Escopo: Interage com a `SymbolTable` para registrar variáveis (`VarDeclNode`) e verificar existência (`VarAccess`).
  * - Atualização de Tabela: Preenche os tipos das variáveis na tabela de símbolos para a saída final.
  * - Validação de Contexto: Usa o parâmetro `insideLoop` para impedir comandos como `break` fora de laços de repetição.
@@ -43,1018 +53,266 @@ class StmtNode;
  * * 4. Arrays e Ponteiros:
  * - `ArrayAccessNode` e `ArrayAssignNode` tratam a indexação, permitindo semanticamente
  * que variáveis escalares (int/float) sejam tratadas como arrays, conforme permitido pela gramática.
+ *
+ * 5. Memória:
+ * - Todos os nós e listas de filhos de uma compilação ficam na `Arena` do parser (ver arena.hpp).
+ * Os ponteiros para os filhos não são donos, nenhum nó é destruído individualmente, e a árvore
+ * inteira é liberada de uma vez junto com a Arena, qualquer que seja a sua profundidade.
  */
 
+// Operadores das expressões binárias. O parser escolhe o operador pela ação
+// semântica (#BUILD_ADD, ...); o texto só é usado na impressão e no TAC.
+enum class BinaryOp : uint8_t
+{
+  ADD, SUB, MUL, DIV, MOD,
+  LT, GT, LE, GE, EQ, NEQ
+};
+
+inline std::string_view binaryOpSymbol(BinaryOp op)
+{
+  static constexpr std::string_view symbols[] = {"+", "-", "*", "/", "%", "<", ">", "<=", ">=", "==", "!="};
+  return symbols[(size_t)op];
+}
+
+// Classe concreta de cada nó, para quem percorre a árvore sem chamadas
+// virtuais (src/ast.cpp, ast_visitor.hpp, flat_ast.hpp). `None` não é usado
+// na hierarquia: na FlatAST, marca uma posição de filho vazia.
+enum class NodeKind : uint8_t
+{
+  None,
+  Program, FuncDef, Block, VarDecl, Assign, If, For, While, Return, Print, Read, Break,
+  FuncCall, VarAccess, BinaryExpr, IntLiteral, FloatLiteral, StringLiteral, ArrayAccess, ArrayAssign
+};
+
 class ASTNode
 {
 public:
-  int line = 0;
+  // Posição no código fonte; a linha só é calculada para mensagens de erro
+  SourceOffset offset = NoOffset;
+  const NodeKind kind;
+  explicit ASTNode(NodeKind k) : kind(k) {}
+  int line() const { return lineIndex().line(offset); }
   inline static bool hasSemanticError = false;
   virtual ~ASTNode() = default;
-  virtual void print(int level = 0) const = 0;
-  virtual std::string checkType(SymbolTable &symtab, bool insideLoop = false)
-  {
-    (void)symtab;
-    (void)insideLoop;
-    return "";
-  }
 
-  virtual std::string genCode(CodeGenerator &gen, std::string loopExit = "")
-  {
-    (void)gen;
-    (void)loopExit;
-    return "";
-  }
-
-protected:
-  void printIndent(int level) const
-  {
-    for (int i = 0; i < level; ++i)
-      std::cout << "  ";
-  }
+  // Nenhuma das três passadas tem a profundidade da árvore limitada pela
+  // pilha nativa: `print` e `checkType` usam uma pilha explícita, e
+  // `genCode` só recorre a ela abaixo de 256 níveis (ver src/ast.cpp)
+  void print(int level = 0) const;
+  TypeId checkType(SymbolTable &symtab, bool insideLoop = false);
+  Address genCode(CodeGenerator &gen, Address loopExit = {});
 };
 
 class ExprNode : public ASTNode
 {
 public:
-  std::string type;
+  TypeId type = TypeId::None;
+  explicit ExprNode(NodeKind k) : ASTNode(k) {}
 };
 
 class IntLiteral : public ExprNode
 {
 public:
   int value;
-  IntLiteral(int val) : value(val) { type = "int"; }
-  void print(int level = 0) const override
-  {
-    printIndent(level);
-    std::cout << "IntLiteral: " << value << "\n";
-  }
-  std::string checkType(SymbolTable &symtab, bool insideLoop = false) override
-  {
-    (void)symtab;
-    (void)insideLoop;
-    return "int";
-  }
-  std::string genCode(CodeGenerator &gen, std::string loopExit = "") override
-  {
-    (void)gen;
-    (void)loopExit;
-    return std::to_string(value);
-  }
+  IntLiteral(int val) : ExprNode(NodeKind::IntLiteral), value(val) { type = TypeId::Int; }
 };
 
 class FloatLiteral : public ExprNode
 {
 public:
   float value;
-  FloatLiteral(float val) : value(val) { type = "float"; }
-  void print(int level = 0) const override
-  {
-    printIndent(level);
-    std::cout << "FloatLiteral: " << value << "\n";
-  }
-  std::string checkType(SymbolTable &symtab, bool insideLoop = false) override
-  {
-    (void)symtab;
-    (void)insideLoop;
-    return "float";
-  }
-  std::string genCode(CodeGenerator &gen, std::string loopExit = "") override
-  {
-    (void)gen;
-    (void)loopExit;
-    return std::to_string(value);
-  }
+  FloatLiteral(float val) : ExprNode(NodeKind::FloatLiteral), value(val) { type = TypeId::Float; }
 };
 
 class StringLiteral : public ExprNode
 {
 public:
-  std::string value;
-  StringLiteral(std::string val) : value(val) { type = "string"; }
-  void print(int level = 0) const override
-  {
-    printIndent(level);
-    std::cout << "StringLiteral: " << value << "\n";
-  }
-  std::string checkType(SymbolTable &symtab, bool insideLoop = false) override
-  {
-    (void)symtab;
-    (void)insideLoop;
-    return "string";
-  }
-
-  std::string genCode(CodeGenerator &gen, std::string loopExit = "") override
-  {
-    (void)gen;
-    (void)loopExit;
-    // Retorna a string entre aspas para ser usada no código intermediário
-    return "\"" + value + "\"";
-  }
+  SymbolId value;
+  StringLiteral(SymbolId val) : ExprNode(NodeKind::StringLiteral), value(val) { type = TypeId::String; }
 };
 
 class FuncCallNode : public ExprNode
 {
 public:
-  std::string name;
-  std::vector<std::unique_ptr<ASTNode>> args;
-
-  FuncCallNode(std::string n) : name(n) {}
+  SymbolId name;
+  ArenaVector<ASTNode *> args;
 
-  void addArg(std::unique_ptr<ASTNode> arg)
-  {
-    args.push_back(std::move(arg));
-  }
-
-  void print(int level = 0) const override
-  {
-    printIndent(level);
-    std::cout << "FuncCall: " << name << "\n";
-    for (const auto &arg : args)
-    {
-      arg->print(level + 1);
-    }
-  }
-
-  std::string checkType(SymbolTable &symtab, bool insideLoop = false) override
-  {
-    (void)insideLoop;
-    SymbolEntry *entry = symtab.lookup(name);
-    if (!entry)
-    {
-      hasSemanticError = true;
-      std::cerr << "Erro semântico: Função '" << name << "' não declarada na linha " << line << ".\n";
-      return "ERROR";
-    }
-    return entry->type;
-  }
+  FuncCallNode(SymbolId n, Arena &arena) : ExprNode(NodeKind::FuncCall), name(n), args(ArenaAllocator<ASTNode *>(arena)) {}
 
-  std::string genCode(CodeGenerator &gen, std::string loopExit = "") override
+  void addArg(ASTNode *arg)
   {
-    std::vector<std::string> argAddrs;
-    for (const auto &arg : args)
-    {
-      argAddrs.push_back(arg->genCode(gen, loopExit));
-    }
-
-    for (const auto &addr : argAddrs)
-    {
-      gen.emit("param " + addr);
-    }
-
-    std::string t = gen.newTemp();
-    gen.emit(t, "call " + name + ", " + std::to_string(args.size()));
-    return t;
+    args.push_back(arg);
   }
 };
 
 class VarAccess : public ExprNode
 {
 public:
-  std::string name;
-  VarAccess(std::string n) : name(n) {}
-  void print(int level = 0) const override
-  {
-    printIndent(level);
-    std::cout << "VarAccess: " << name << "\n";
-  }
-  std::string checkType(SymbolTable &symtab, bool insideLoop = false) override
-  {
-    (void)insideLoop;
-    SymbolEntry *entry = symtab.lookup(name);
-    if (!entry)
-    {
-      hasSemanticError = true;
-      std::cerr << "Erro semântico: Variável '" << name << "' não declarada na linha " << line << ".\n";
-      return "ERROR";
-    }
-    if (entry->type.empty())
-    {
-      return "ERROR";
-    }
-    return entry->type;
-  }
-  std::string genCode(CodeGenerator &gen, std::string loopExit = "") override
-  {
-    (void)gen;
-    (void)loopExit;
-    return name;
-  }
+  SymbolId name;
+  VarAccess(SymbolId n) : ExprNode(NodeKind::VarAccess), name(n) {}
 };
 
 class BinaryExpr : public ExprNode
 {
 public:
-  std::unique_ptr<ExprNode> left;
-  std::unique_ptr<ExprNode> right;
-  std::string op;
+  ExprNode *left;
+  ExprNode *right;
+  BinaryOp op;
 
-  BinaryExpr(std::unique_ptr<ExprNode> l, std::string o, std::unique_ptr<ExprNode> r)
-      : left(std::move(l)), right(std::move(r)), op(o) {}
-
-  void print(int level = 0) const override
-  {
-    printIndent(level);
-    std::cout << "BinaryExpr: " << op << "\n";
-    if (left)
-      left->print(level + 1);
-    if (right)
-      right->print(level + 1);
-  }
-
-  std::string checkType(SymbolTable &symtab, bool insideLoop = false) override
-  {
-    std::string leftType = left->checkType(symtab, insideLoop);
-    std::string rightType = right->checkType(symtab, insideLoop);
-
-    if (leftType == "ERROR" || rightType == "ERROR")
-      return "ERROR";
-
-    if (leftType == rightType)
-    {
-      return leftType;
-    }
-
-    hasSemanticError = true;
-    std::cerr << "Erro semântico: Tipos incompatíveis (" << leftType << " " << op << " " << rightType << ") na linha " << line << ".\n";
-    return "ERROR";
-  }
-
-  std::string genCode(CodeGenerator &gen, std::string loopExit = "") override
-  {
-    std::string t1 = left->genCode(gen, loopExit);
-    std::string t2 = right->genCode(gen, loopExit);
-
-    std::string temp = gen.newTemp();
-    // t0 = t1 + t2
-    gen.emit(temp, t1, op, t2);
-
-    return temp;
-  }
+  BinaryExpr(ExprNode *l, BinaryOp o, ExprNode *r)
+      : ExprNode(NodeKind::BinaryExpr), left(l), right(r), op(o) {}
 };
 
 class StmtNode : public ASTNode
 {
+public:
+  explicit StmtNode(NodeKind k) : ASTNode(k) {}
 };
 
 class BlockNode : public StmtNode
 {
 public:
-  std::vector<std::unique_ptr<ASTNode>> statements;
-
-  void addStatement(std::unique_ptr<ASTNode> stmt)
-  {
-    statements.push_back(std::move(stmt));
-  }
-
-  void print(int level = 0) const override
-  {
-    printIndent(level);
-    std::cout << "{\n";
-    for (const auto &stmt : statements)
-    {
-      stmt->print(level + 1);
-    }
-    printIndent(level);
-    std::cout << "}\n";
-  }
+  ArenaVector<ASTNode *> statements;
 
-  std::string checkType(SymbolTable &symtab, bool insideLoop = false) override
-  {
-    symtab.enterScope();
-    for (const auto &stmt : statements)
-    {
-      stmt->checkType(symtab, insideLoop);
-    }
-    symtab.exitScope();
-    return "";
-  }
+  BlockNode(Arena &arena) : StmtNode(NodeKind::Block), statements(ArenaAllocator<ASTNode *>(arena)) {}
 
-  std::string genCode(CodeGenerator &gen, std::string loopExit = "") override
+  void addStatement(ASTNode *stmt)
   {
-    for (const auto &stmt : statements)
-    {
-      if (stmt)
-        stmt->genCode(gen, loopExit);
-    }
-    return "";
+    statements.push_back(stmt);
   }
 };
 
 class VarDeclNode : public StmtNode
 {
 public:
-  std::string typeName;
-  std::string varName;
-  std::unique_ptr<ExprNode> initializer;
-
-  VarDeclNode(std::string type, std::string name, std::unique_ptr<ExprNode> init = nullptr)
-      : typeName(type), varName(name), initializer(std::move(init)) {}
-
-  void print(int level = 0) const override
-  {
-    printIndent(level);
-    std::cout << "VarDecl: " << typeName << " " << varName << "\n";
-    if (initializer)
-    {
-      initializer->print(level + 1);
-    }
-  }
-
-  std::string checkType(SymbolTable &symtab, bool insideLoop = false) override
-  {
-    SymbolEntry *entry = symtab.lookup(varName);
-    if (entry)
-    {
-      if (entry->type.empty())
-      {
-        entry->type = typeName;
-        if (initializer)
-        {
-          initializer->checkType(symtab, insideLoop);
-        }
-        return "void";
-      }
-      else
-      {
-        hasSemanticError = true;
-        std::cerr << "Erro semântico: Variável '" << varName << "' já declarada na linha " << line << ".\n";
-        return "ERROR";
-      }
-    }
+  TypeId typeName;
+  SymbolId varName;
+  ExprNode *initializer;
 
-    symtab.addOccurrence(varName, 0, 0);
-    entry = symtab.lookup(varName);
-    if (entry)
-    {
-      entry->type = typeName;
-    }
-    if (initializer)
-    {
-      initializer->checkType(symtab, insideLoop);
-    }
-    return "void";
-  }
-
-  std::string genCode(CodeGenerator &gen, std::string loopExit = "") override
-  {
-    if (initializer)
-    {
-      std::string valAddr = initializer->genCode(gen, loopExit);
-      // x = val
-      gen.emit(varName, valAddr);
-    }
-    return varName;
-  }
+  VarDeclNode(TypeId type, SymbolId name, ExprNode *init = nullptr)
+      : StmtNode(NodeKind::VarDecl), typeName(type), varName(name), initializer(init) {}
 };
 
 class AssignNode : public StmtNode
 {
 public:
-  std::string varName;
-  std::unique_ptr<ExprNode> value;
+  SymbolId varName;
+  ExprNode *value;
 
-  AssignNode(std::string name, std::unique_ptr<ExprNode> val)
-      : varName(name), value(std::move(val)) {}
-
-  void print(int level = 0) const override
-  {
-    printIndent(level);
-    std::cout << "Assign: " << varName << "\n";
-    if (value)
-      value->print(level + 1);
-  }
-
-  std::string checkType(SymbolTable &symtab, bool insideLoop = false) override
-  {
-    std::string exprType = value->checkType(symtab, insideLoop);
-    SymbolEntry *entry = symtab.lookup(varName);
-    if (!entry)
-    {
-      hasSemanticError = true;
-      std::cerr << "Erro semântico: Variável '" << varName << "' não declarada na linha " << line << ".\n";
-      return "ERROR";
-    }
-
-    bool typesMatch = (entry->type == exprType);
-
-    if (!typesMatch && exprType != "ERROR")
-    {
-      hasSemanticError = true;
-      std::cerr << "Erro semântico: Atribuição inválida. Variável '" << varName
-                << "' é do tipo " << entry->type << " mas recebeu " << exprType << " na linha " << line << ".\n";
-      return "ERROR";
-    }
-    return entry->type;
-  }
-
-  std::string genCode(CodeGenerator &gen, std::string loopExit = "") override
-  {
-    std::string valAddr = value->genCode(gen, loopExit);
-    gen.emit(varName, valAddr);
-    return varName;
-  }
+  AssignNode(SymbolId name, ExprNode *val)
+      : StmtNode(NodeKind::Assign), varName(name), value(val) {}
 };
 class IfStmt : public StmtNode
 {
 public:
-  std::unique_ptr<ExprNode> condition;
-  std::unique_ptr<StmtNode> thenBranch;
-  std::unique_ptr<StmtNode> elseBranch;
+  ExprNode *condition;
+  StmtNode *thenBranch;
+  StmtNode *elseBranch;
 
-  IfStmt(std::unique_ptr<ExprNode> cond, std::unique_ptr<StmtNode> thenB, std::unique_ptr<StmtNode> elseB = nullptr)
-      : condition(std::move(cond)), thenBranch(std::move(thenB)), elseBranch(std::move(elseB)) {}
-
-  void print(int level = 0) const override
-  {
-    printIndent(level);
-    std::cout << "IfStmt\n";
-    printIndent(level + 1);
-    std::cout << "Condition:\n";
-    if (condition)
-      condition->print(level + 2);
-    printIndent(level + 1);
-    std::cout << "Then:\n";
-    if (thenBranch)
-      thenBranch->print(level + 2);
-    if (elseBranch)
-    {
-      printIndent(level + 1);
-      std::cout << "Else:\n";
-      elseBranch->print(level + 2);
-    }
-  }
-
-  std::string checkType(SymbolTable &symtab, bool insideLoop = false) override
-  {
-    if (condition)
-      condition->checkType(symtab, insideLoop);
-    if (thenBranch)
-      thenBranch->checkType(symtab, insideLoop);
-    if (elseBranch)
-      elseBranch->checkType(symtab, insideLoop);
-    return "";
-  }
-
-  std::string genCode(CodeGenerator &gen, std::string loopExit = "") override
-  {
-    std::string condAddr = condition->genCode(gen, loopExit);
-
-    std::string labelElse = gen.newLabel();
-    std::string labelEnd = gen.newLabel();
-
-    // ifFalse cond goto L_Else
-    gen.emit("ifFalse " + condAddr + " goto " + labelElse);
-
-    if (thenBranch)
-      thenBranch->genCode(gen, loopExit);
-    gen.emit("goto " + labelEnd);
-
-    gen.emitLabel(labelElse);
-    if (elseBranch)
-      elseBranch->genCode(gen, loopExit);
-
-    gen.emitLabel(labelEnd);
-    return "";
-  }
+  IfStmt(ExprNode *cond, StmtNode *thenB, StmtNode *elseB = nullptr)
+      : StmtNode(NodeKind::If), condition(cond), thenBranch(thenB), elseBranch(elseB) {}
 };
 
 class ForStmt : public StmtNode
 {
 public:
-  std::unique_ptr<StmtNode> init;
-  std::unique_ptr<ExprNode> condition;
-  std::unique_ptr<StmtNode> update;
-  std::unique_ptr<StmtNode> body;
-
-  ForStmt(std::unique_ptr<StmtNode> i, std::unique_ptr<ExprNode> c, std::unique_ptr<StmtNode> u, std::unique_ptr<StmtNode> b)
-      : init(std::move(i)), condition(std::move(c)), update(std::move(u)), body(std::move(b)) {}
-
-  void print(int level = 0) const override
-  {
-    printIndent(level);
-    std::cout << "ForStmt\n";
-    printIndent(level + 1);
-    std::cout << "Init:\n";
-    if (init)
-      init->print(level + 2);
-    printIndent(level + 1);
-    std::cout << "Condition:\n";
-    if (condition)
-      condition->print(level + 2);
-    printIndent(level + 1);
-    std::cout << "Update:\n";
-    if (update)
-      update->print(level + 2);
-    printIndent(level + 1);
-    std::cout << "Body:\n";
-    if (body)
-      body->print(level + 2);
-  }
-
-  std::string checkType(SymbolTable &symtab, bool insideLoop = false) override
-  {
-    (void)insideLoop;
-    symtab.enterScope(); // For loop has its own scope for init variables
-    if (init)
-      init->checkType(symtab, false);
-    if (condition)
-      condition->checkType(symtab, true);
-    if (update)
-      update->checkType(symtab, true);
-    if (body)
-      body->checkType(symtab, true); // Pass true for insideLoop
-    symtab.exitScope();
-    return "";
-  }
-
-  std::string genCode(CodeGenerator &gen, std::string loopExit = "") override
-  {
-    (void)loopExit; // O for cria um novo contexto de loop
-
-    // Estrutura do Loop em TAC:
-    // 1. Inicialização (ex: i = 0)
-    // 2. Label de Início (L_start) <- Ponto de retorno
-    // 3. Teste de Condição. Se Falso, pula para L_end (Break implícito)
-    // 4. Corpo do Loop (passamos L_end para permitir 'break' internos)
-    // 5. Atualização (ex: i = i + 1)
-    // 6. Goto incondicional para L_start
-    // 7. Label de Fim (L_end)
-
-    if (init)
-      init->genCode(gen, "");
-
-    std::string labelStart = gen.newLabel();
-    std::string labelEnd = gen.newLabel(); // Este é o label para break
-
-    gen.emitLabel(labelStart);
-
-    if (condition)
-    {
-      std::string condAddr = condition->genCode(gen, "");
-      gen.emit("ifFalse " + condAddr + " goto " + labelEnd);
-    }
-
-    // O corpo recebe labelEnd para lidar com break
-    if (body)
-      body->genCode(gen, labelEnd);
-
-    if (update)
-      update->genCode(gen, "");
+  StmtNode *init;
+  ExprNode *condition;
+  StmtNode *update;
+  StmtNode *body;
 
-    gen.emit("goto " + labelStart);
-    gen.emitLabel(labelEnd);
-
-    return "";
-  }
+  ForStmt(StmtNode *i, ExprNode *c, StmtNode *u, StmtNode *b)
+      : StmtNode(NodeKind::For), init(i), condition(c), update(u), body(b) {}
 };
 
 class WhileStmt : public StmtNode
 {
 public:
-  std::unique_ptr<ExprNode> condition;
-  std::unique_ptr<StmtNode> body;
-
-  WhileStmt(std::unique_ptr<ExprNode> cond, std::unique_ptr<StmtNode> b)
-      : condition(std::move(cond)), body(std::move(b)) {}
-
-  void print(int level = 0) const override
-  {
-    printIndent(level);
-    std::cout << "WhileStmt\n";
-    printIndent(level + 1);
-    std::cout << "Condition:\n";
-    if (condition)
-      condition->print(level + 2);
-    printIndent(level + 1);
-    std::cout << "Body:\n";
-    if (body)
-      body->print(level + 2);
-  }
-
-  std::string checkType(SymbolTable &symtab, bool insideLoop = false) override
-  {
-    (void)insideLoop;
-    if (condition)
-      condition->checkType(symtab, true); // Condition is inside loop context? Maybe not strictly, but body is.
-    if (body)
-      body->checkType(symtab, true); // Pass true for insideLoop
-    return "";
-  }
-
-  std::string genCode(CodeGenerator &gen, std::string loopExit = "") override
-  {
-    (void)loopExit; // While cria novo contexto
-    std::string labelStart = gen.newLabel();
-    std::string labelEnd = gen.newLabel();
-
-    gen.emitLabel(labelStart);
-
-    if (condition)
-    {
-      std::string condAddr = condition->genCode(gen, "");
-      gen.emit("ifFalse " + condAddr + " goto " + labelEnd);
-    }
-
-    if (body)
-      body->genCode(gen, labelEnd);
+  ExprNode *condition;
+  StmtNode *body;
 
-    gen.emit("goto " + labelStart);
-    gen.emitLabel(labelEnd);
-    return "";
-  }
+  WhileStmt(ExprNode *cond, StmtNode *b)
+      : StmtNode(NodeKind::While), condition(cond), body(b) {}
 };
 
 class ReturnNode : public StmtNode
 {
 public:
-  std::unique_ptr<ExprNode> value;
-  std::string inferredType = "void";
-
-  ReturnNode(std::unique_ptr<ExprNode> val = nullptr) : value(std::move(val)) {}
-
-  void print(int level = 0) const override
-  {
-    printIndent(level);
-    std::cout << "Return\n";
-    if (value)
-    {
-      value->print(level + 1);
-    }
-  }
-
-  std::string checkType(SymbolTable &symtab, bool insideLoop = false) override
-  {
-    (void)insideLoop;
-    if (value)
-    {
-      inferredType = value->checkType(symtab, insideLoop);
-      return inferredType;
-    }
-    return "void";
-  }
+  ExprNode *value;
 
-  std::string genCode(CodeGenerator &gen, std::string loopExit = "") override
-  {
-    (void)loopExit;
-    if (value)
-    {
-      std::string valAddr = value->genCode(gen, "");
-      gen.emit("return " + valAddr);
-    }
-    else
-    {
-      gen.emit("return");
-    }
-    return "";
-  }
+  ReturnNode(ExprNode *val = nullptr) : StmtNode(NodeKind::Return), value(val) {}
 };
 
 class PrintStmt : public StmtNode
 {
 public:
-  std::unique_ptr<ExprNode> expression;
-
-  PrintStmt(std::unique_ptr<ExprNode> expr) : expression(std::move(expr)) {}
-
-  void print(int level = 0) const override
-  {
-    printIndent(level);
-    std::cout << "PrintStmt\n";
-    if (expression)
-    {
-      expression->print(level + 1);
-    }
-  }
+  ExprNode *expression;
 
-  std::string checkType(SymbolTable &symtab, bool insideLoop = false) override
-  {
-    if (expression)
-    {
-      return expression->checkType(symtab, insideLoop);
-    }
-    return "void";
-  }
-
-  std::string genCode(CodeGenerator &gen, std::string loopExit = "") override
-  {
-    if (expression)
-    {
-      std::string val = expression->genCode(gen, loopExit);
-      gen.emit("print " + val);
-    }
-    return "";
-  }
+  PrintStmt(ExprNode *expr) : StmtNode(NodeKind::Print), expression(expr) {}
 };
 
 class ReadStmt : public StmtNode
 {
 public:
-  std::string varName;
-
-  ReadStmt(std::string name) : varName(name) {}
-
-  void print(int level = 0) const override
-  {
-    printIndent(level);
-    std::cout << "ReadStmt: " << varName << "\n";
-  }
+  SymbolId varName;
 
-  std::string checkType(SymbolTable &symtab, bool insideLoop = false) override
-  {
-    (void)insideLoop;
-    SymbolEntry *entry = symtab.lookup(varName);
-    if (!entry)
-    {
-      hasSemanticError = true;
-      std::cerr << "Erro semântico: Variável '" << varName << "' não declarada na linha " << line << ".\n";
-      return "ERROR";
-    }
-    return entry->type;
-  }
-
-  std::string genCode(CodeGenerator &gen, std::string loopExit = "") override
-  {
-    (void)loopExit;
-    gen.emit("read " + varName);
-    return "";
-  }
+  ReadStmt(SymbolId name) : StmtNode(NodeKind::Read), varName(name) {}
 };
 
 class BreakStmt : public StmtNode
 {
 public:
-  void print(int level = 0) const override
-  {
-    printIndent(level);
-    std::cout << "BreakStmt\n";
-  }
-
-  std::string checkType(SymbolTable &symtab, bool insideLoop = false) override
-  {
-    (void)symtab;
-    if (!insideLoop)
-    {
-      hasSemanticError = true;
-      std::cerr << "Erro semântico: 'break' fora de loop na linha " << line << "\n";
-      return "ERROR";
-    }
-    return "void";
-  }
-
-  std::string genCode(CodeGenerator &gen, std::string loopExit = "") override
-  {
-    if (!loopExit.empty())
-    {
-      gen.emit("goto " + loopExit);
-    }
-    else
-    {
-      std::cerr << "Erro GCI: Break encontrado fora de contexto de loop.\n";
-    }
-    return "";
-  }
+  BreakStmt() : StmtNode(NodeKind::Break) {}
 };
 
 class FuncDefNode : public ASTNode
 {
 public:
-  std::string name;
-  std::vector<std::unique_ptr<VarDeclNode>> parameters;
-  std::unique_ptr<BlockNode> body;
-
-  FuncDefNode(std::string n, std::unique_ptr<BlockNode> b)
-      : name(n), body(std::move(b)) {}
-
-  void addParameter(std::unique_ptr<VarDeclNode> param)
-  {
-    parameters.push_back(std::move(param));
-  }
-
-  void print(int level = 0) const override
-  {
-    printIndent(level);
-    std::cout << "FuncDef: " << name << "\n";
-    printIndent(level + 1);
-    std::cout << "Params:\n";
-    for (const auto &param : parameters)
-    {
-      param->print(level + 2);
-    }
-    if (body)
-    {
-      body->print(level + 1);
-    }
-  }
-
-  std::string checkType(SymbolTable &symtab, bool insideLoop = false) override
-  {
-    (void)insideLoop;
-    // 1. Add function to current scope (Global/Parent)
-    std::string returnType = "int"; // Default assumption
-    symtab.addOccurrence(name, 0, 0);
-    SymbolEntry *entry = symtab.lookup(name);
-    if (entry)
-      entry->type = returnType;
-
-    symtab.enterScope();
-    for (const auto &param : parameters)
-    {
-      param->checkType(symtab, false); // Functions are not loops
-    }
-    if (body)
-    {
-      body->checkType(symtab, false); // Functions are not loops
+  SymbolId name;
+  ArenaVector<VarDeclNode *> parameters;
+  BlockNode *body;
 
-      // Infer return type from ReturnNode (top-level only for now)
-      for (const auto &stmt : body->statements)
-      {
-        if (auto retNode = dynamic_cast<ReturnNode *>(stmt.get()))
-        {
-          if (retNode->inferredType != "ERROR" && retNode->inferredType != "void")
-          {
-            returnType = retNode->inferredType;
-          }
-        }
-      }
-    }
-    symtab.exitScope();
-
-    // Update function type in symbol table
-    if (entry)
-      entry->type = returnType;
-
-    return "";
-  }
+  FuncDefNode(SymbolId n, BlockNode *b, Arena &arena)
+      : ASTNode(NodeKind::FuncDef), name(n), parameters(ArenaAllocator<VarDeclNode *>(arena)), body(b) {}
 
-  std::string genCode(CodeGenerator &gen, std::string loopExit = "") override
+  void addParameter(VarDeclNode *param)
   {
-    (void)loopExit;
-    gen.emitLabel(name);
-
-    if (body)
-      body->genCode(gen, "");
-
-    return "";
+    parameters.push_back(param);
   }
 };
 
 class ProgramNode : public ASTNode
 {
 public:
-  std::vector<std::unique_ptr<ASTNode>> globals;
+  ArenaVector<ASTNode *> globals;
 
-  void addGlobal(std::unique_ptr<ASTNode> node)
-  {
-    globals.push_back(std::move(node));
-  }
-
-  void print(int level = 0) const override
-  {
-    std::cout << "ProgramNode\n";
-    for (const auto &node : globals)
-    {
-      node->print(level + 1);
-    }
-  }
+  ProgramNode(Arena &arena) : ASTNode(NodeKind::Program), globals(ArenaAllocator<ASTNode *>(arena)) {}
 
-  std::string checkType(SymbolTable &symtab, bool insideLoop = false) override
+  void addGlobal(ASTNode *node)
   {
-    (void)insideLoop;
-    // Do not create a new scope for ProgramNode, so globals are in Scope 0
-    for (const auto &node : globals)
-    {
-      node->checkType(symtab, false);
-    }
-    return "";
-  }
-
-  std::string genCode(CodeGenerator &gen, std::string loopExit = "") override
-  {
-    (void)loopExit;
-    for (const auto &node : globals)
-    {
-      if (node)
-        node->genCode(gen, "");
-    }
-    return "";
+    globals.push_back(node);
   }
 };
 
 class ArrayAccessNode : public ExprNode
 {
 public:
-  std::string name;
-  std::unique_ptr<ExprNode> index;
-
-  ArrayAccessNode(std::string n, std::unique_ptr<ExprNode> idx)
-      : name(n), index(std::move(idx)) {}
-
-  void print(int level = 0) const override
-  {
-    printIndent(level);
-    std::cout << "ArrayAccess: " << name << "\n";
-    if (index)
-      index->print(level + 1);
-  }
+  SymbolId name;
+  ExprNode *index;
 
-  std::string checkType(SymbolTable &symtab, bool insideLoop = false) override
-  {
-    std::string indexType = index->checkType(symtab, insideLoop);
-    if (indexType != "int")
-    {
-      hasSemanticError = true;
-      std::cerr << "Erro semântico: Índice de array deve ser inteiro na linha " << line << ".\n";
-      return "ERROR";
-    }
-
-    SymbolEntry *entry = symtab.lookup(name);
-    if (!entry)
-    {
-      hasSemanticError = true;
-      std::cerr << "Erro semântico: Array '" << name << "' não declarado na linha " << line << ".\n";
-      return "ERROR";
-    }
-    // Permitimos int, float, string serem indexados (como ponteiros)
-    return entry->type;
-  }
-
-  std::string genCode(CodeGenerator &gen, std::string loopExit = "") override
-  {
-    std::string idxAddr = index->genCode(gen, loopExit);
-    std::string temp = gen.newTemp();
-    // Emite: t0 = arr[i]
-    gen.emit(temp, name + "[" + idxAddr + "]");
-    return temp;
-  }
+  ArrayAccessNode(SymbolId n, ExprNode *idx)
+      : ExprNode(NodeKind::ArrayAccess), name(n), index(idx) {}
 };
 
 class ArrayAssignNode : public StmtNode
 {
 public:
-  std::string name;
-  std::unique_ptr<ExprNode> index;
-  std::unique_ptr<ExprNode> value;
-
-  ArrayAssignNode(std::string n, std::unique_ptr<ExprNode> idx, std::unique_ptr<ExprNode> val)
-      : name(n), index(std::move(idx)), value(std::move(val)) {}
+  SymbolId name;
+  ExprNode *index;
+  ExprNode *value;
 
-  void print(int level = 0) const override
-  {
-    printIndent(level);
-    std::cout << "ArrayAssign: " << name << "\n";
-    printIndent(level + 1);
-    std::cout << "Index:\n";
-    if (index)
-      index->print(level + 2);
-    printIndent(level + 1);
-    std::cout << "Value:\n";
-    if (value)
-      value->print(level + 2);
-  }
-
-  std::string checkType(SymbolTable &symtab, bool insideLoop = false) override
-  {
-    std::string indexType = index->checkType(symtab, insideLoop);
-    if (indexType != "int")
-    {
-      hasSemanticError = true;
-      std::cerr << "Erro semântico: Índice de array deve ser inteiro na linha " << line << ".\n";
-      return "ERROR";
-    }
-
-    SymbolEntry *entry = symtab.lookup(name);
-    if (!entry)
-    {
-      hasSemanticError = true;
-      std::cerr << "Erro semântico: Array '" << name << "' não declarado na linha " << line << ".\n";
-      return "ERROR";
-    }
-
-    std::string valType = value->checkType(symtab, insideLoop);
-
-    // Verifica compatibilidade (ex: array int recebe valor int)
-    bool typesMatch = (entry->type == valType);
-
-    if (!typesMatch && valType != "ERROR")
-    {
-      hasSemanticError = true;
-      std::cerr << "Erro semântico: Atribuição inválida no array na linha " << line << ".\n";
-      return "ERROR";
-    }
-
-    return "";
-  }
-
-  std::string genCode(CodeGenerator &gen, std::string loopExit = "") override
-  {
-    std::string idxAddr = index->genCode(gen, loopExit);
-    std::string valAddr = value->genCode(gen, loopExit);
-    // arr[i] = val
-    gen.emit(name + "[" + idxAddr + "]", valAddr);
-    return "";
-  }
+  ArrayAssignNode(SymbolId n, ExprNode *idx, ExprNode *val)
+      : StmtNode(NodeKind::ArrayAssign), name(n), index(idx), value(val) {}
 };
 
 #endif
@@ -0,0 +1,899 @@
+#ifndef AST_PASSES_HPP
+#define AST_PASSES_HPP
+
+#include "ast.hpp"
+#include "code_generator.hpp"
+#include "symbol_table.hpp"
+#include "types.hpp"
+#include <array>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Regras da análise semântica e da geração do TAC, escritas uma única
+ * vez para as duas representações da árvore: a hierarquia de `ASTNode`s (ver
+ * src/ast.cpp) e a FlatAST (ver src/flat_ast.cpp).
+ *
+ * `passes::check` e `passes::generate` recebem um `Tree`, que só diz como
+ * chegar aos filhos e aos dados de um nó naquela representação:
+ *
+ * - `Node` (ponteiro ou índice), `Cursor` e `Tree::none`, o nó ausente;
+ * - `kind(n)`, chamado só para nós presentes;
+ * - `begin(n)` e `next<K>(n, cursor)`: os filhos, na ordem e até `none`, de
+ *   Program, Block, FuncCall, FuncDef (parâmetros e depois o corpo) e o filho
+ *   opcional de VarDecl, Return e Print;
+ * - `child<K>(n, i)`: a posição `i` dos nós com filhos em posições fixas
+ *   (Assign, If, For, While, BinaryExpr, ArrayAccess, ArrayAssign), ou `none`
+ *   se estiver vazia;
+ * - `funcBody(n)`, `name<K>(n)`, `stringValue`, `intValue`, `floatConst`,
+ *   `op`, `declName`, `declType` e `line(n)`.
+ *
+ * `check` usa um vetor de quadros no lugar da pilha de chamadas. O quadro do
+ * topo é um nó em andamento, e `step` conta os filhos que ele já visitou. A
+ * cada volta, o nó decide, pelo seu `kind` e por `step`, se visita mais um
+ * filho (empilhando um quadro) ou se termina com o valor `result`; quando um
+ * filho termina, `result` é o valor dele e o pai continua de onde parou.
+ * Folhas (literais, variáveis, break...) e operações binárias entre duas
+ * folhas são resolvidas diretamente pelo pai, sem quadro.
+ *
+ * As regras do TAC ficam só em `genStep<K>`, que avança um nó do tipo K de
+ * um filho ao seguinte. `generate` é recursiva: `genKind<K>` repete os passos
+ * de genStep e gera cada filho pela função do tipo dele, numa tabela indexada
+ * pelo `kind`, como faria uma vtable. Abaixo de `RecursionDepth` níveis, a
+ * subárvore continua em `genFrames`, que aplica os mesmos passos com quadros
+ * como os de `check`; assim nenhuma das passadas tem a profundidade da árvore
+ * limitada pela pilha nativa.
+ */
+namespace passes
+{
+    // Mensagens de erro da análise semântica (src/ast_passes.cpp). Todas
+    // marcam ASTNode::hasSemanticError e devolvem TypeId::Error
+    TypeId undeclared(const char *what, SymbolId name, int line);
+    TypeId breakOutsideLoop(int line);
+    TypeId redeclared(SymbolId name, int line);
+    TypeId invalidAssignment(SymbolId name, TypeId expected, TypeId got, int line);
+    TypeId incompatibleOperands(TypeId left, BinaryOp op, TypeId right, int line);
+    TypeId nonIntegerIndex(int line);
+    TypeId undeclaredArray(SymbolId name, int line);
+    TypeId invalidArrayAssignment(int line);
+
+    // Operador de BinaryExpr já internado, para as instruções do TAC
+    SymbolId operatorSymbol(BinaryOp op);
+
+    // Nós sem filhos a visitar na análise semântica (FuncCall não verifica
+    // os argumentos)
+    constexpr bool isCheckLeaf(NodeKind k)
+    {
+        switch (k)
+        {
+        case NodeKind::IntLiteral:
+        case NodeKind::FloatLiteral:
+        case NodeKind::StringLiteral:
+        case NodeKind::VarAccess:
+        case NodeKind::FuncCall:
+        case NodeKind::Read:
+        case NodeKind::Break:
+            return true;
+        default:
+            return false;
+        }
+    }
+
+    // O mesmo para a geração de código
+    constexpr bool isGenLeaf(NodeKind k)
+    {
+        return k != NodeKind::FuncCall && isCheckLeaf(k);
+    }
+
+    template <typename Tree>
+    TypeId checkLeaf(const Tree &tree, typename Tree::Node node, SymbolTable &symtab, bool insideLoop)
+    {
+        switch (tree.kind(node))
+        {
+        case NodeKind::IntLiteral:
+            return TypeId::Int;
+        case NodeKind::FloatLiteral:
+            return TypeId::Float;
+        case NodeKind::StringLiteral:
+            return TypeId::String;
+        case NodeKind::VarAccess:
+        {
+            SymbolId name = tree.template name<NodeKind::VarAccess>(node);
+            SymbolEntry *entry = symtab.lookup(name);
+            if (!entry)
+                return undeclared("Variável", name, tree.line(node));
+            if (entry->type == TypeId::None)
+                return TypeId::Error;
+            return entry->type;
+        }
+        case NodeKind::FuncCall:
+        {
+            SymbolId name = tree.template name<NodeKind::FuncCall>(node);
+            SymbolEntry *entry = symtab.lookup(name);
+            if (!entry)
+                return undeclared("Função", name, tree.line(node));
+            return entry->type;
+        }
+        case NodeKind::Read:
+        {
+            SymbolId name = tree.template name<NodeKind::Read>(node);
+            SymbolEntry *entry = symtab.lookup(name);
+            if (!entry)
+                return undeclared("Variável", name, tree.line(node));
+            return entry->type;
+        }
+        case NodeKind::Break:
+            if (!insideLoop)
+                return breakOutsideLoop(tree.line(node));
+            return TypeId::Void;
+        default:
+            return TypeId::None;
+        }
+    }
+
+    // Label do `break` guardado nos quadros da geração de código: só o número,
+    // ou NoLabel fora de laços
+    constexpr uint32_t NoLabel = UINT32_MAX;
+
+    inline Address labelAddress(uint32_t label)
+    {
+        return {Address::Kind::Label, label};
+    }
+
+    // Literais e variáveis: o endereço é o próprio valor, sem nenhuma instrução
+    template <typename Tree>
+    Address valueAddress(const Tree &tree, typename Tree::Node node, NodeKind kind)
+    {
+        switch (kind)
+        {
+        case NodeKind::IntLiteral:
+            return Address::intConst(tree.intValue(node));
+        case NodeKind::FloatLiteral:
+            return tree.floatConst(node);
+        case NodeKind::StringLiteral:
+            // A string é impressa entre aspas no código intermediário
+            return Address::stringConst(tree.stringValue(node));
+        case NodeKind::VarAccess:
+            return Address::name(tree.template name<NodeKind::VarAccess>(node));
+        default:
+            return {};
+        }
+    }
+
+    // Nós sem filhos a gerar; `kind` é o tipo de `node`
+    template <typename Tree>
+    Address genLeaf(const Tree &tree, typename Tree::Node node, NodeKind kind, CodeGenerator &gen, uint32_t loopExit)
+    {
+        switch (kind)
+        {
+        case NodeKind::Read:
+            gen.emitRead(Address::name(tree.template name<NodeKind::Read>(node)));
+            return {};
+        case NodeKind::Break:
+            if (loopExit != NoLabel)
+                gen.emitGoto(labelAddress(loopExit));
+            else
+                std::cerr << "Erro GCI: Break encontrado fora de contexto de loop.\n";
+            return {};
+        default:
+            return valueAddress(tree, node, kind);
+        }
+    }
+
+    // Instruções de cada nó, já com os valores dos filhos
+
+    template <typename Tree>
+    Address genDecl(const Tree &tree, typename Tree::Node node, CodeGenerator &gen, const Address *init)
+    {
+        Address var = Address::name(tree.declName(node));
+        if (init)
+            gen.emit(var, *init); // x = val
+        return var;
+    }
+
+    template <typename Tree>
+    Address genAssign(const Tree &tree, typename Tree::Node node, CodeGenerator &gen, const Address &value)
+    {
+        Address var = Address::name(tree.template name<NodeKind::Assign>(node));
+        gen.emit(var, value);
+        return var;
+    }
+
+    template <typename Tree>
+    Address genBinary(const Tree &tree, typename Tree::Node node, CodeGenerator &gen, const Address &left,
+                      const Address &right)
+    {
+        Address temp = gen.newTemp();
+        // t0 = t1 + t2
+        gen.emit(temp, left, operatorSymbol(tree.op(node)), right);
+        return temp;
+    }
+
+    // Os `count` últimos endereços de `args` são os argumentos, que saem de lá
+    template <typename Tree>
+    Address genCall(const Tree &tree, typename Tree::Node node, CodeGenerator &gen, std::vector<Address> &args,
+                    uint32_t count)
+    {
+        for (size_t i = args.size() - count; i < args.size(); ++i)
+            gen.emitParam(args[i]);
+        args.resize(args.size() - count);
+        Address temp = gen.newTemp();
+        gen.emitCall(temp, Address::name(tree.template name<NodeKind::FuncCall>(node)), count);
+        return temp;
+    }
+
+    // Primeiro filho presente de um nó com posições fixas a partir de `step`
+    // (avançando `step` até ele), ou `none` se não houver mais
+    template <NodeKind K, typename Tree>
+    typename Tree::Node nextSlot(const Tree &tree, typename Tree::Node node, uint32_t &step, uint32_t count)
+    {
+        for (; step < count; ++step)
+        {
+            typename Tree::Node child = tree.template child<K>(node, step);
+            if (child != Tree::none)
+                return child;
+        }
+        return Tree::none;
+    }
+
+    // Tipo de `left op right`; o mesmo tipo dos dois lados é o único aceito
+    template <typename Tree>
+    TypeId binaryType(const Tree &tree, typename Tree::Node node, TypeId left, TypeId right)
+    {
+        if (left == TypeId::Error || right == TypeId::Error)
+            return TypeId::Error;
+        if (left != right)
+            return incompatibleOperands(left, tree.op(node), right, tree.line(node));
+        return right;
+    }
+
+    // Operação binária entre duas folhas (como `i + 1`): o pai a resolve sem
+    // empilhar um quadro, como faz com as folhas
+    template <typename Tree>
+    bool hasLeafOperands(const Tree &tree, typename Tree::Node node, bool (*isLeaf)(NodeKind))
+    {
+        typename Tree::Node left = tree.template child<NodeKind::BinaryExpr>(node, 0);
+        typename Tree::Node right = tree.template child<NodeKind::BinaryExpr>(node, 1);
+        return left != Tree::none && right != Tree::none && isLeaf(tree.kind(left)) && isLeaf(tree.kind(right));
+    }
+
+    // Tipo de um filho que dispensa quadro, em `result`; falso se ele precisa de um
+    template <typename Tree>
+    bool checkInline(const Tree &tree, typename Tree::Node node, SymbolTable &symtab, bool insideLoop, TypeId &result)
+    {
+        NodeKind k = tree.kind(node);
+        if (isCheckLeaf(k))
+        {
+            result = checkLeaf(tree, node, symtab, insideLoop);
+            return true;
+        }
+        if (k != NodeKind::BinaryExpr || !hasLeafOperands(tree, node, isCheckLeaf))
+            return false;
+        TypeId left = checkLeaf(tree, tree.template child<NodeKind::BinaryExpr>(node, 0), symtab, insideLoop);
+        TypeId right = checkLeaf(tree, tree.template child<NodeKind::BinaryExpr>(node, 1), symtab, insideLoop);
+        result = binaryType(tree, node, left, right);
+        return true;
+    }
+
+    /**
+     * @brief Análise semântica da subárvore de `root`: escopos, declarações,
+     * tipos das expressões e `break` fora de laço.
+     */
+    template <typename Tree>
+    TypeId check(const Tree &tree, typename Tree::Node root, SymbolTable &symtab, bool insideLoop)
+    {
+        using Node = typename Tree::Node;
+        if (isCheckLeaf(tree.kind(root)))
+            return checkLeaf(tree, root, symtab, insideLoop);
+
+        // Os quadros são construídos no lugar (emplace_back): montar um
+        // temporário e copiá-lo para a pilha custa caro a cada nó
+        struct Frame
+        {
+            Node node;
+            typename Tree::Cursor cursor;
+            uint32_t step = 0;
+            bool insideLoop;
+            TypeId saved = TypeId::None; // operando esquerdo (BinaryExpr) ou retorno (FuncDef)
+            SymbolEntry *entry = nullptr;
+
+            Frame(const Tree &tree, Node node, bool insideLoop)
+                : node(node), cursor(tree.begin(node)), insideLoop(insideLoop) {}
+        };
+
+        std::vector<Frame> stack;
+        stack.emplace_back(tree, root, insideLoop);
+        TypeId result = TypeId::None;
+
+        while (!stack.empty())
+        {
+            Frame &f = stack.back();
+            Node n = f.node;
+            Node visit = Tree::none;
+            bool childLoop = f.insideLoop;
+
+            switch (tree.kind(n))
+            {
+            case NodeKind::Program:
+                // Sem escopo próprio: as declarações globais ficam no escopo 0
+                childLoop = false;
+                visit = tree.template next<NodeKind::Program>(n, f.cursor);
+                result = TypeId::None;
+                break;
+
+            case NodeKind::Block:
+                if (f.step == 0)
+                    symtab.enterScope();
+                visit = tree.template next<NodeKind::Block>(n, f.cursor);
+                if (visit == Tree::none)
+                {
+                    symtab.exitScope();
+                    result = TypeId::None;
+                }
+                break;
+
+            case NodeKind::For:
+                if (f.step == 0)
+                    symtab.enterScope(); // as variáveis da inicialização ficam no escopo do for
+                visit = nextSlot<NodeKind::For>(tree, n, f.step, 4);
+                childLoop = f.step != 0; // só a inicialização fica fora do laço
+                if (visit == Tree::none)
+                {
+                    symtab.exitScope();
+                    result = TypeId::None;
+                }
+                break;
+
+            case NodeKind::While:
+                childLoop = true;
+                visit = nextSlot<NodeKind::While>(tree, n, f.step, 2);
+                result = TypeId::None;
+                break;
+
+            case NodeKind::If:
+                visit = nextSlot<NodeKind::If>(tree, n, f.step, 3);
+                result = TypeId::None;
+                break;
+
+            case NodeKind::FuncDef:
+                if (f.step == 0)
+                {
+                    // A função entra no escopo de quem a declara, com tipo int
+                    // até que um return no corpo diga outro
+                    SymbolId name = tree.template name<NodeKind::FuncDef>(n);
+                    symtab.addOccurrence(name, NoOffset);
+                    f.entry = symtab.lookup(name);
+                    if (f.entry)
+                        f.entry->type = TypeId::Int;
+                    f.saved = TypeId::Int;
+                    symtab.enterScope();
+                }
+                childLoop = false;
+                visit = tree.template next<NodeKind::FuncDef>(n, f.cursor);
+                if (visit == Tree::none)
+                {
+                    symtab.exitScope();
+                    if (f.entry)
+                        f.entry->type = f.saved;
+                    result = TypeId::None;
+                }
+                break;
+
+            case NodeKind::VarDecl:
+            {
+                if (f.step != 0)
+                {
+                    result = TypeId::Void;
+                    break;
+                }
+                SymbolId name = tree.declName(n);
+                SymbolEntry *entry = symtab.lookup(name);
+                if (entry && entry->type != TypeId::None)
+                {
+                    result = redeclared(name, tree.line(n));
+                    break;
+                }
+                if (!entry)
+                {
+                    symtab.addOccurrence(name, NoOffset);
+                    entry = symtab.lookup(name);
+                }
+                if (entry)
+                    entry->type = tree.declType(n);
+                visit = tree.template next<NodeKind::VarDecl>(n, f.cursor);
+                result = TypeId::Void;
+                break;
+            }
+
+            case NodeKind::Assign:
+            {
+                if (f.step == 0)
+                {
+                    visit = tree.template child<NodeKind::Assign>(n, 0);
+                    break;
+                }
+                SymbolId name = tree.template name<NodeKind::Assign>(n);
+                SymbolEntry *entry = symtab.lookup(name);
+                if (!entry)
+                    result = undeclared("Variável", name, tree.line(n));
+                else if (entry->type != result && result != TypeId::Error)
+                    result = invalidAssignment(name, entry->type, result, tree.line(n));
+                else
+                    result = entry->type;
+                break;
+            }
+
+            case NodeKind::Return:
+                if (f.step == 0)
+                {
+                    visit = tree.template next<NodeKind::Return>(n, f.cursor);
+                    if (visit == Tree::none)
+                        result = TypeId::Void;
+                    break;
+                }
+                // Um return diretamente no corpo de uma função define o tipo dela
+                if (stack.size() >= 3 && result != TypeId::Error && result != TypeId::Void)
+                {
+                    Frame &block = stack[stack.size() - 2];
+                    Frame &func = stack[stack.size() - 3];
+                    if (tree.kind(block.node) == NodeKind::Block && tree.kind(func.node) == NodeKind::FuncDef)
+                        func.saved = result;
+                }
+                break;
+
+            case NodeKind::Print:
+                if (f.step == 0)
+                {
+                    visit = tree.template next<NodeKind::Print>(n, f.cursor);
+                    result = TypeId::Void;
+                }
+                break;
+
+            case NodeKind::BinaryExpr:
+            {
+                if (f.step == 1)
+                    f.saved = result;
+                if (f.step < 2)
+                {
+                    visit = tree.template child<NodeKind::BinaryExpr>(n, f.step);
+                    break;
+                }
+                result = binaryType(tree, n, f.saved, result);
+                break;
+            }
+
+            case NodeKind::ArrayAccess:
+            case NodeKind::ArrayAssign:
+            {
+                bool access = tree.kind(n) == NodeKind::ArrayAccess;
+                if (f.step == 0)
+                {
+                    visit = access ? tree.template child<NodeKind::ArrayAccess>(n, 0)
+                                   : tree.template child<NodeKind::ArrayAssign>(n, 0);
+                    break;
+                }
+                if (f.step == 1)
+                {
+                    if (result != TypeId::Int)
+                    {
+                        result = nonIntegerIndex(tree.line(n));
+                        break;
+                    }
+                    SymbolId name = access ? tree.template name<NodeKind::ArrayAccess>(n)
+                                           : tree.template name<NodeKind::ArrayAssign>(n);
+                    f.entry = symtab.lookup(name);
+                    if (!f.entry)
+                    {
+                        result = undeclaredArray(name, tree.line(n));
+                        break;
+                    }
+                    // Permitimos int, float, string serem indexados (como ponteiros)
+                    if (access)
+                        result = f.entry->type;
+                    else
+                        visit = tree.template child<NodeKind::ArrayAssign>(n, 1);
+                    break;
+                }
+                // Verifica compatibilidade (ex: array int recebe valor int)
+                if (f.entry->type != result && result != TypeId::Error)
+                    result = invalidArrayAssignment(tree.line(n));
+                else
+                    result = TypeId::None;
+                break;
+            }
+
+            default:
+                result = checkLeaf(tree, n, symtab, f.insideLoop);
+                break;
+            }
+
+            if (visit == Tree::none)
+            {
+                stack.pop_back();
+                continue;
+            }
+            ++f.step;
+            if (!checkInline(tree, visit, symtab, childLoop, result))
+                stack.emplace_back(tree, visit, childLoop);
+        }
+        return result;
+    }
+
+    // Nó da geração do TAC em andamento: `step` conta os filhos que ele já
+    // visitou, e os demais campos guardam o que ele usa entre um filho e outro
+    template <typename Tree>
+    struct GenFrame
+    {
+        typename Tree::Node node;
+        typename Tree::Cursor cursor;
+        uint32_t step = 0;
+        uint32_t loopExit;
+        uint32_t label = NoLabel; // label de fim
+        Address saved;            // operando esquerdo, índice, label de início ou do else
+
+        GenFrame(const Tree &tree, typename Tree::Node node, uint32_t loopExit)
+            : node(node), cursor(tree.begin(node)), loopExit(loopExit) {}
+    };
+
+    /**
+     * @brief As regras do TAC para um nó do tipo K, um filho por vez. Com o
+     * valor do último filho visitado em `result`, emite o que vem antes do
+     * filho seguinte e o devolve, com o label de `break` dele em `childExit`;
+     * sem mais filhos, devolve `none`, com o valor do nó em `result`. Quem
+     * visita os filhos é genKind, por recursão, ou genFrames, com quadros.
+     */
+    template <NodeKind K, typename Tree>
+    inline typename Tree::Node genStep(const Tree &tree, GenFrame<Tree> &f, CodeGenerator &gen, std::vector<Address> &args,
+                                Address &result, uint32_t &childExit)
+    {
+        using Node = typename Tree::Node;
+        Node n = f.node;
+        Node visit = Tree::none;
+        // As chamadas de `gen` recebem cópias (`value`, `Address(f.saved)`): uma
+        // referência a `result` ou ao quadro obrigaria genKind a mantê-los na
+        // memória, e não em registradores
+        const Address value = result;
+
+        switch (K)
+        {
+        case NodeKind::Program:
+            // As declarações globais não estão em um laço
+            childExit = NoLabel;
+            visit = tree.template next<NodeKind::Program>(n, f.cursor);
+            result = {};
+            break;
+
+        case NodeKind::Block:
+            visit = tree.template next<NodeKind::Block>(n, f.cursor);
+            result = {};
+            break;
+
+        case NodeKind::FuncDef:
+            // Os parâmetros não geram código, só o corpo
+            if (f.step == 0)
+            {
+                gen.emitLabel(Address::name(tree.template name<NodeKind::FuncDef>(n)));
+                visit = tree.funcBody(n);
+                childExit = NoLabel;
+            }
+            result = {};
+            break;
+
+        case NodeKind::VarDecl:
+            if (f.step == 0)
+            {
+                visit = tree.template next<NodeKind::VarDecl>(n, f.cursor);
+                if (visit != Tree::none)
+                    break;
+            }
+            result = genDecl(tree, n, gen, f.step != 0 ? &value : nullptr);
+            break;
+
+        case NodeKind::Assign:
+            if (f.step == 0)
+            {
+                visit = tree.template child<NodeKind::Assign>(n, 0);
+                break;
+            }
+            result = genAssign(tree, n, gen, value);
+            break;
+
+        case NodeKind::If:
+            switch (f.step)
+            {
+            case 0:
+                visit = tree.template child<NodeKind::If>(n, 0);
+                break;
+            case 1:
+                f.saved = gen.newLabel();       // else
+                f.label = gen.newLabel().value; // fim
+                // ifFalse cond goto L_Else
+                gen.emitIfFalse(value, Address(f.saved));
+                if ((visit = tree.template child<NodeKind::If>(n, 1)) != Tree::none)
+                    break;
+                f.step = 2;
+                [[fallthrough]];
+            case 2:
+                gen.emitGoto(labelAddress(f.label));
+                gen.emitLabel(Address(f.saved));
+                if ((visit = tree.template child<NodeKind::If>(n, 2)) != Tree::none)
+                    break;
+                [[fallthrough]];
+            default:
+                gen.emitLabel(labelAddress(f.label));
+                result = {};
+                break;
+            }
+            break;
+
+        case NodeKind::For:
+            // Estrutura do Loop em TAC:
+            // 1. Inicialização (ex: i = 0)
+            // 2. Label de Início (L_start) <- Ponto de retorno
+            // 3. Teste de Condição. Se Falso, pula para L_end (Break implícito)
+            // 4. Corpo do Loop (passamos L_end para permitir 'break' internos)
+            // 5. Atualização (ex: i = i + 1)
+            // 6. Goto incondicional para L_start
+            // 7. Label de Fim (L_end)
+            // Os filhos são inicialização, condição, atualização e corpo
+            childExit = NoLabel; // O for cria um novo contexto de loop
+            switch (f.step)
+            {
+            case 0:
+                if ((visit = tree.template child<NodeKind::For>(n, 0)) != Tree::none)
+                    break;
+                f.step = 1;
+                [[fallthrough]];
+            case 1:
+                f.saved = gen.newLabel();
+                f.label = gen.newLabel().value; // Este é o label para break
+                gen.emitLabel(Address(f.saved));
+                if ((visit = tree.template child<NodeKind::For>(n, 1)) != Tree::none)
+                    break;
+                f.step = 2;
+                [[fallthrough]];
+            case 2:
+                if (tree.template child<NodeKind::For>(n, 1) != Tree::none)
+                    gen.emitIfFalse(value, labelAddress(f.label));
+                // O corpo recebe labelEnd para lidar com break
+                childExit = f.label;
+                if ((visit = tree.template child<NodeKind::For>(n, 3)) != Tree::none)
+                    break;
+                f.step = 3;
+                childExit = NoLabel;
+                [[fallthrough]];
+            case 3:
+                if ((visit = tree.template child<NodeKind::For>(n, 2)) != Tree::none)
+                    break;
+                [[fallthrough]];
+            default:
+                gen.emitGoto(Address(f.saved));
+                gen.emitLabel(labelAddress(f.label));
+                result = {};
+                break;
+            }
+            break;
+
+        case NodeKind::While:
+            childExit = NoLabel; // While cria novo contexto
+            switch (f.step)
+            {
+            case 0:
+                f.saved = gen.newLabel();
+                f.label = gen.newLabel().value;
+                gen.emitLabel(Address(f.saved));
+                if ((visit = tree.template child<NodeKind::While>(n, 0)) != Tree::none)
+                    break;
+                f.step = 1;
+                [[fallthrough]];
+            case 1:
+                if (tree.template child<NodeKind::While>(n, 0) != Tree::none)
+                    gen.emitIfFalse(value, labelAddress(f.label));
+                childExit = f.label;
+                if ((visit = tree.template child<NodeKind::While>(n, 1)) != Tree::none)
+                    break;
+                [[fallthrough]];
+            default:
+                gen.emitGoto(Address(f.saved));
+                gen.emitLabel(labelAddress(f.label));
+                result = {};
+                break;
+            }
+            break;
+
+        case NodeKind::Return:
+            if (f.step == 0)
+            {
+                visit = tree.template next<NodeKind::Return>(n, f.cursor);
+                childExit = NoLabel;
+                if (visit != Tree::none)
+                    break;
+                gen.emitReturn();
+            }
+            else
+            {
+                gen.emitReturn(value);
+            }
+            result = {};
+            break;
+
+        case NodeKind::Print:
+            if (f.step == 0)
+            {
+                visit = tree.template next<NodeKind::Print>(n, f.cursor);
+                if (visit != Tree::none)
+                    break;
+            }
+            else
+            {
+                gen.emitPrint(value);
+            }
+            result = {};
+            break;
+
+        case NodeKind::FuncCall:
+            if (f.step != 0)
+                args.push_back(value);
+            visit = tree.template next<NodeKind::FuncCall>(n, f.cursor);
+            if (visit != Tree::none)
+                break;
+            result = genCall(tree, n, gen, args, f.step);
+            break;
+
+        case NodeKind::BinaryExpr:
+            if (f.step == 1)
+                f.saved = value;
+            if (f.step < 2)
+            {
+                visit = tree.template child<NodeKind::BinaryExpr>(n, f.step);
+                break;
+            }
+            result = genBinary(tree, n, gen, Address(f.saved), value);
+            break;
+
+        case NodeKind::ArrayAccess:
+        {
+            if (f.step == 0)
+            {
+                visit = tree.template child<NodeKind::ArrayAccess>(n, 0);
+                break;
+            }
+            Address temp = gen.newTemp();
+            // Emite: t0 = arr[i]
+            gen.emitLoadIndex(temp, Address::name(tree.template name<NodeKind::ArrayAccess>(n)), value);
+            result = temp;
+            break;
+        }
+
+        case NodeKind::ArrayAssign:
+            if (f.step == 1)
+                f.saved = value;
+            if (f.step < 2)
+            {
+                visit = tree.template child<NodeKind::ArrayAssign>(n, f.step);
+                break;
+            }
+            // arr[i] = val
+            gen.emitStoreIndex(Address::name(tree.template name<NodeKind::ArrayAssign>(n)), Address(f.saved), value);
+            result = {};
+            break;
+
+        default:
+            result = genLeaf(tree, n, K, gen, f.loopExit);
+            break;
+        }
+        return visit;
+    }
+
+    // Níveis da árvore gerados por recursão; abaixo deles, genFrames continua
+    // a subárvore, e a pilha nativa não limita a profundidade da árvore. Com
+    // PASSES_RECURSION_DEPTH=0 (test/frames_compiler), tudo passa por genFrames
+#ifndef PASSES_RECURSION_DEPTH
+#define PASSES_RECURSION_DEPTH 256
+#endif
+    constexpr uint32_t RecursionDepth = PASSES_RECURSION_DEPTH;
+
+    template <typename Tree>
+    Address genNode(const Tree &tree, typename Tree::Node node, CodeGenerator &gen, uint32_t loopExit,
+                    std::vector<Address> &args, uint32_t depth);
+
+    // Código da subárvore de `node`, do tipo K, que está `depth` níveis abaixo
+    // da raiz: os passos de genStep, com cada filho gerado por recursão
+    template <NodeKind K, typename Tree>
+    Address genKind(const Tree &tree, typename Tree::Node node, CodeGenerator &gen, uint32_t loopExit,
+                    std::vector<Address> &args, uint32_t depth)
+    {
+        if constexpr (isGenLeaf(K))
+            return genLeaf(tree, node, K, gen, loopExit);
+
+        GenFrame<Tree> f(tree, node, loopExit);
+        Address result;
+        for (;;)
+        {
+            uint32_t childExit = loopExit;
+            typename Tree::Node visit = genStep<K>(tree, f, gen, args, result, childExit);
+            if (visit == Tree::none)
+                return result;
+            ++f.step;
+            result = genNode(tree, visit, gen, childExit, args, depth);
+        }
+    }
+
+    constexpr size_t KindCount = (size_t)NodeKind::ArrayAssign + 1;
+
+    // Os passos de cada tipo de nó, na posição do seu `NodeKind`
+    template <typename Tree, size_t... K>
+    constexpr auto stepTable(std::index_sequence<K...>)
+    {
+        using Step = typename Tree::Node (*)(const Tree &, GenFrame<Tree> &, CodeGenerator &, std::vector<Address> &,
+                                             Address &, uint32_t &);
+        return std::array<Step, sizeof...(K)>{&genStep<(NodeKind)K, Tree>...};
+    }
+
+    // Geração com um vetor de quadros no lugar da pilha de chamadas, para as
+    // subárvores abaixo de RecursionDepth níveis: os mesmos passos de genKind,
+    // com o quadro do topo no lugar da chamada em andamento
+    template <typename Tree>
+    Address genFrames(const Tree &tree, typename Tree::Node root, CodeGenerator &gen, uint32_t loopExit,
+                      std::vector<Address> &args)
+    {
+        static constexpr auto steps = stepTable<Tree>(std::make_index_sequence<KindCount>{});
+        std::vector<GenFrame<Tree>> stack;
+        stack.emplace_back(tree, root, loopExit);
+        Address result;
+
+        while (!stack.empty())
+        {
+            GenFrame<Tree> &f = stack.back();
+            uint32_t childExit = f.loopExit;
+            typename Tree::Node visit = steps[(size_t)tree.kind(f.node)](tree, f, gen, args, result, childExit);
+            if (visit == Tree::none)
+            {
+                stack.pop_back();
+                continue;
+            }
+            ++f.step;
+            if (isGenLeaf(tree.kind(visit)))
+                result = genLeaf(tree, visit, tree.kind(visit), gen, childExit);
+            else
+                stack.emplace_back(tree, visit, childExit);
+        }
+        return result;
+    }
+
+
+    // A função de cada tipo de nó, na posição do seu `NodeKind`
+    template <typename Tree, size_t... K>
+    constexpr auto genTable(std::index_sequence<K...>)
+    {
+        using Gen = Address (*)(const Tree &, typename Tree::Node, CodeGenerator &, uint32_t, std::vector<Address> &,
+                                uint32_t);
+        return std::array<Gen, sizeof...(K)>{&genKind<(NodeKind)K, Tree>...};
+    }
+
+    // Gera `node` pela função do seu tipo, ou por genFrames no limite da recursão
+    template <typename Tree>
+    inline Address genNode(const Tree &tree, typename Tree::Node node, CodeGenerator &gen, uint32_t loopExit,
+                           std::vector<Address> &args, uint32_t depth)
+    {
+        static constexpr auto gens = genTable<Tree>(std::make_index_sequence<KindCount>{});
+        if (depth == RecursionDepth)
+            return genFrames(tree, node, gen, loopExit, args);
+        return gens[(size_t)tree.kind(node)](tree, node, gen, loopExit, args, depth + 1);
+    }
+
+    /**
+     * @brief Geração do TAC da subárvore de `root`. `loopExit` é o label para
+     * onde vai um `break` (vazio fora de laços); os argumentos de uma chamada
+     * ficam em `args` até todos serem gerados.
+     */
+    template <typename Tree>
+    Address generate(const Tree &tree, typename Tree::Node root, CodeGenerator &gen, const Address &loopExit)
+    {
+        std::vector<Address> args; // argumentos das chamadas em andamento
+        return genNode(tree, root, gen, loopExit.empty() ? NoLabel : loopExit.value, args, 0);
+    }
+}
+
+#endif
@@ -0,0 +1,203 @@
+#ifndef AST_VISITOR_HPP
+#define AST_VISITOR_HPP
+
+#include "ast.hpp"
+#include <algorithm>
+#include <type_traits>
+#include <vector>
+
+// `T` com o mesmo const de `Node` (ASTNode ou const ASTNode)
+template <typename Node, typename T>
+using SameConst = std::conditional_t<std::is_const_v<Node>, const T, T>;
+
+/**
+ * @brief Visitante da AST com despacho estático (CRTP).
+ *
+ * Uma passada nova sobre a árvore (dobra de constantes, vivacidade, impressão,
+ * ...) é uma classe `Derived : ASTVisitor<Derived, R>` que define apenas os
+ * `visitX` dos nós que lhe interessam; os demais caem em `visitNode`, que por
+ * padrão não faz nada e devolve `R()`. Nenhuma classe de ast.hpp precisa mudar.
+ *
+ * `visit` escolhe o método por um `switch` sobre `kind`, compilado como tabela
+ * de saltos, e a chamada ao método de `Derived` é resolvida em tempo de
+ * compilação (e normalmente expandida no lugar): não há chamada virtual por nó.
+ *
+ * `visit` trata um único nó. A ordem dos filhos fica a cargo da passada, que
+ * em geral usa `forEachChild` e uma pilha própria (como `walkTree`) para não
+ * depender da profundidade da pilha nativa. Com `Node = const ASTNode`, os
+ * métodos recebem os nós como const.
+ */
+template <typename Derived, typename R = void, typename Node = ASTNode>
+class ASTVisitor
+{
+public:
+    R visit(Node &node)
+    {
+        switch (node.kind)
+        {
+        case NodeKind::Program:
+            return self().visitProgram(static_cast<SameConst<Node, ProgramNode> &>(node));
+        case NodeKind::FuncDef:
+            return self().visitFuncDef(static_cast<SameConst<Node, FuncDefNode> &>(node));
+        case NodeKind::Block:
+            return self().visitBlock(static_cast<SameConst<Node, BlockNode> &>(node));
+        case NodeKind::VarDecl:
+            return self().visitVarDecl(static_cast<SameConst<Node, VarDeclNode> &>(node));
+        case NodeKind::Assign:
+            return self().visitAssign(static_cast<SameConst<Node, AssignNode> &>(node));
+        case NodeKind::If:
+            return self().visitIf(static_cast<SameConst<Node, IfStmt> &>(node));
+        case NodeKind::For:
+            return self().visitFor(static_cast<SameConst<Node, ForStmt> &>(node));
+        case NodeKind::While:
+            return self().visitWhile(static_cast<SameConst<Node, WhileStmt> &>(node));
+        case NodeKind::Return:
+            return self().visitReturn(static_cast<SameConst<Node, ReturnNode> &>(node));
+        case NodeKind::Print:
+            return self().visitPrint(static_cast<SameConst<Node, PrintStmt> &>(node));
+        case NodeKind::Read:
+            return self().visitRead(static_cast<SameConst<Node, ReadStmt> &>(node));
+        case NodeKind::Break:
+            return self().visitBreak(static_cast<SameConst<Node, BreakStmt> &>(node));
+        case NodeKind::FuncCall:
+            return self().visitFuncCall(static_cast<SameConst<Node, FuncCallNode> &>(node));
+        case NodeKind::VarAccess:
+            return self().visitVarAccess(static_cast<SameConst<Node, VarAccess> &>(node));
+        case NodeKind::BinaryExpr:
+            return self().visitBinaryExpr(static_cast<SameConst<Node, BinaryExpr> &>(node));
+        case NodeKind::IntLiteral:
+            return self().visitIntLiteral(static_cast<SameConst<Node, IntLiteral> &>(node));
+        case NodeKind::FloatLiteral:
+            return self().visitFloatLiteral(static_cast<SameConst<Node, FloatLiteral> &>(node));
+        case NodeKind::StringLiteral:
+            return self().visitStringLiteral(static_cast<SameConst<Node, StringLiteral> &>(node));
+        case NodeKind::ArrayAccess:
+            return self().visitArrayAccess(static_cast<SameConst<Node, ArrayAccessNode> &>(node));
+        case NodeKind::ArrayAssign:
+            return self().visitArrayAssign(static_cast<SameConst<Node, ArrayAssignNode> &>(node));
+        case NodeKind::None:
+            break;
+        }
+        return self().visitNode(node);
+    }
+
+    R visitNode(Node &) { return R(); }
+
+    R visitProgram(SameConst<Node, ProgramNode> &node) { return self().visitNode(node); }
+    R visitFuncDef(SameConst<Node, FuncDefNode> &node) { return self().visitNode(node); }
+    R visitBlock(SameConst<Node, BlockNode> &node) { return self().visitNode(node); }
+    R visitVarDecl(SameConst<Node, VarDeclNode> &node) { return self().visitNode(node); }
+    R visitAssign(SameConst<Node, AssignNode> &node) { return self().visitNode(node); }
+    R visitIf(SameConst<Node, IfStmt> &node) { return self().visitNode(node); }
+    R visitFor(SameConst<Node, ForStmt> &node) { return self().visitNode(node); }
+    R visitWhile(SameConst<Node, WhileStmt> &node) { return self().visitNode(node); }
+    R visitReturn(SameConst<Node, ReturnNode> &node) { return self().visitNode(node); }
+    R visitPrint(SameConst<Node, PrintStmt> &node) { return self().visitNode(node); }
+    R visitRead(SameConst<Node, ReadStmt> &node) { return self().visitNode(node); }
+    R visitBreak(SameConst<Node, BreakStmt> &node) { return self().visitNode(node); }
+    R visitFuncCall(SameConst<Node, FuncCallNode> &node) { return self().visitNode(node); }
+    R visitVarAccess(SameConst<Node, VarAccess> &node) { return self().visitNode(node); }
+    R visitBinaryExpr(SameConst<Node, BinaryExpr> &node) { return self().visitNode(node); }
+    R visitIntLiteral(SameConst<Node, IntLiteral> &node) { return self().visitNode(node); }
+    R visitFloatLiteral(SameConst<Node, FloatLiteral> &node) { return self().visitNode(node); }
+    R visitStringLiteral(SameConst<Node, StringLiteral> &node) { return self().visitNode(node); }
+    R visitArrayAccess(SameConst<Node, ArrayAccessNode> &node) { return self().visitNode(node); }
+    R visitArrayAssign(SameConst<Node, ArrayAssignNode> &node) { return self().visitNode(node); }
+
+private:
+    Derived &self() { return static_cast<Derived &>(*this); }
+};
+
+// Visitante de forEachChild: chama `callback` em cada filho direto não nulo
+template <typename Node, typename F>
+class ChildVisitor : public ASTVisitor<ChildVisitor<Node, F>, void, Node>
+{
+public:
+    explicit ChildVisitor(F &f) : callback(f) {}
+
+    void visitProgram(SameConst<Node, ProgramNode> &node) { each(node.globals); }
+    void visitFuncDef(SameConst<Node, FuncDefNode> &node)
+    {
+        each(node.parameters);
+        child(node.body);
+    }
+    void visitBlock(SameConst<Node, BlockNode> &node) { each(node.statements); }
+    void visitVarDecl(SameConst<Node, VarDeclNode> &node) { child(node.initializer); }
+    void visitAssign(SameConst<Node, AssignNode> &node) { child(node.value); }
+    void visitIf(SameConst<Node, IfStmt> &node)
+    {
+        child(node.condition);
+        child(node.thenBranch);
+        child(node.elseBranch);
+    }
+    void visitFor(SameConst<Node, ForStmt> &node)
+    {
+        child(node.init);
+        child(node.condition);
+        child(node.update);
+        child(node.body);
+    }
+    void visitWhile(SameConst<Node, WhileStmt> &node)
+    {
+        child(node.condition);
+        child(node.body);
+    }
+    void visitReturn(SameConst<Node, ReturnNode> &node) { child(node.value); }
+    void visitPrint(SameConst<Node, PrintStmt> &node) { child(node.expression); }
+    void visitFuncCall(SameConst<Node, FuncCallNode> &node) { each(node.args); }
+    void visitBinaryExpr(SameConst<Node, BinaryExpr> &node)
+    {
+        child(node.left);
+        child(node.right);
+    }
+    void visitArrayAccess(SameConst<Node, ArrayAccessNode> &node) { child(node.index); }
+    void visitArrayAssign(SameConst<Node, ArrayAssignNode> &node)
+    {
+        child(node.index);
+        child(node.value);
+    }
+
+private:
+    F &callback;
+
+    template <typename T>
+    void child(T *node)
+    {
+        if (node)
+            callback(static_cast<Node &>(*node));
+    }
+    template <typename List>
+    void each(const List &nodes)
+    {
+        for (auto *node : nodes)
+            child(node);
+    }
+};
+
+// Chama `visit(filho)` para cada filho direto não nulo de `node`, na ordem em
+// que aparecem no código. `Node` é ASTNode ou const ASTNode, e `visit` recebe
+// um `Node &`
+template <typename Node, typename F>
+void forEachChild(Node &node, F &&visit)
+{
+    ChildVisitor<Node, std::remove_reference_t<F>>(visit).visit(node);
+}
+
+// Percorre a subárvore de `root` em pré-ordem, na ordem do código, chamando
+// `visit(nó)` em cada nó, com uma pilha explícita em vez da recursão
+template <typename Node, typename F>
+void walkTree(Node &root, F &&visit)
+{
+    std::vector<Node *> pending{&root};
+    while (!pending.empty())
+    {
+        Node *node = pending.back();
+        pending.pop_back();
+        visit(*node);
+        size_t first = pending.size();
+        forEachChild(*node, [&pending](Node &child) { pending.push_back(&child); });
+        std::reverse(pending.begin() + first, pending.end());
+    }
+}
+
+#endif
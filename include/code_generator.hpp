@@ -1,11 +1,44 @@
 #ifndef CODE_GENERATOR_HPP
 #define CODE_GENERATOR_HPP
 
+#include "interner.hpp"
+#include <cstdint>
 #include <string>
 #include <vector>
 #include <iostream>
 #include <sstream>
 
+/**
+ * @brief Operando de uma instrução TAC.
+ *
+ * Nomes (variáveis, funções) e strings literais são guardados pelo `SymbolId`
+ * internado; temporários e labels, pelo número; constantes numéricas, pelo valor.
+ * O texto só é montado em `CodeGenerator::printCode`.
+ */
+struct Address
+{
+    enum class Kind : uint8_t
+    {
+        None,
+        Name,
+        Temp,
+        Label,
+        Int,
+        Float,
+        String
+    };
+
+    Kind kind = Kind::None;
+    uint32_t value = 0;
+
+    static Address name(SymbolId id) { return {Kind::Name, id}; }
+    static Address intConst(int v) { return {Kind::Int, (uint32_t)v}; }
+    static Address floatConst(float v);
+    static Address stringConst(SymbolId id) { return {Kind::String, id}; }
+
+    bool empty() const { return kind == Kind::None; }
+};
+
 /**
  * @brief Gerador de Código Intermediário (TAC - Three Address Code).
  * * Esta classe é responsável por linearizar a árvore sintática.
@@ -13,26 +46,69 @@
  * armazenar resultados intermediários de expressões, abstraindo a complexidade
  * de alocação de registradores reais da máquina alvo.
  * Também gerencia a criação de Labels únicos (L0, L1...) para controle de fluxo.
+ *
+ * As instruções são armazenadas de forma estruturada (operação + operandos),
+ * sem nenhuma string, e só são formatadas como texto na impressão.
  */
 
 class CodeGenerator
 {
+public:
+    struct Instr
+    {
+        enum class Op : uint8_t
+        {
+            Copy,       // dest = a
+            Binary,     // dest = a op b
+            Param,      // param a
+            Call,       // dest = call a, count
+            IfFalse,    // ifFalse a goto dest
+            Goto,       // goto dest
+            Label,      // dest:
+            Print,      // print a
+            Read,       // read a
+            Return,     // return [a]
+            LoadIndex,  // dest = a[b]
+            StoreIndex  // dest[a] = b
+        };
+
+        Op op;
+        Address dest;
+        Address a;
+        Address b;
+        uint32_t extra = 0; // operador (SymbolId) em Binary, nº de argumentos em Call
+    };
+
 private:
     int tempCount = 0;
     int labelCount = 0;
-    std::vector<std::string> code;
+    std::vector<Instr> code;
+
+    static void printAddress(std::ostream &out, const Address &addr);
+    void printInstructions(std::ostream &out) const;
 
 public:
-    std::string newTemp();
+    Address newTemp();
 
-    std::string newLabel();
+    Address newLabel();
 
-    void emit(const std::string &instr);
-    void emit(const std::string &dest, const std::string &src);
-    void emit(const std::string &dest, const std::string &arg1, const std::string &op, const std::string &arg2);
-    void emitLabel(const std::string &label);
+    void emit(const Address &dest, const Address &src);
+    void emit(const Address &dest, const Address &arg1, SymbolId op, const Address &arg2);
+    void emitParam(const Address &arg);
+    void emitCall(const Address &dest, const Address &func, uint32_t argCount);
+    void emitIfFalse(const Address &cond, const Address &label);
+    void emitGoto(const Address &label);
+    void emitLabel(const Address &label);
+    void emitPrint(const Address &arg);
+    void emitRead(const Address &arg);
+    void emitReturn(const Address &arg = {});
+    void emitLoadIndex(const Address &dest, const Address &base, const Address &index);
+    void emitStoreIndex(const Address &base, const Address &index, const Address &value);
 
     void printCode() const;
+    // Escreve em `out` as instruções geradas até aqui e as descarta; os
+    // temporários e labels seguintes continuam a numeração (modo --tac-only)
+    void flushCode(std::ostream &out);
 };
 
-#endif
\ No newline at end of file
+#endif
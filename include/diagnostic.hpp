@@ -0,0 +1,40 @@
+#ifndef DIAGNOSTIC_HPP
+#define DIAGNOSTIC_HPP
+
+#include "line_index.hpp"
+#include <ostream>
+#include <string>
+#include <vector>
+
+enum class DiagnosticKind
+{
+    Lexical, // token inválido; encerra a análise (o fluxo de tokens termina nele)
+    Syntax,  // token inesperado; o parser se recupera e continua
+    Literal,    // constante fora do intervalo do tipo; a análise continua
+    Action,     // pilha semântica inconsistente em uma ação #BUILD_*
+    Unsupported // construção que o modo escolhido não traduz; encerra a análise
+};
+
+/**
+ * @brief Um erro encontrado durante a análise, guardado em vez de impresso.
+ *
+ * `message` já vem formatada como o compilador sempre a imprimiu (uma ou mais
+ * linhas, cada uma terminada em '\n'), com linha e coluna calculadas no momento
+ * do erro; `offset` fica disponível para quem quiser apontar o trecho.
+ */
+struct Diagnostic
+{
+    DiagnosticKind kind;
+    SourceOffset offset;
+    std::string message;
+};
+
+using Diagnostics = std::vector<Diagnostic>;
+
+inline void printDiagnostics(std::ostream &out, const Diagnostics &diagnostics)
+{
+    for (const Diagnostic &d : diagnostics)
+        out << d.message;
+}
+
+#endif
@@ -0,0 +1,68 @@
+#ifndef FLAT_AST_HPP
+#define FLAT_AST_HPP
+
+#include "ast.hpp"
+#include "code_generator.hpp"
+#include "symbol_table.hpp"
+#include "types.hpp"
+#include <cstdint>
+#include <vector>
+
+/**
+ * @brief AST em vetores paralelos (structure-of-arrays), indexada por inteiros
+ * de 32 bits.
+ *
+ * É uma cópia da árvore de `ASTNode`s (ver ast.hpp) feita para ser percorrida
+ * sem seguir ponteiros nem fazer chamadas virtuais. O nó `i` é descrito por
+ * `kind[i]`, `firstChild[i]`, `nextSibling[i]`, `payload[i]` e `offset[i]`.
+ * Os nós ficam em pré-ordem: a subárvore de um nó ocupa as posições seguintes
+ * a ele, o primeiro filho (se houver) é o nó seguinte e o próximo irmão é o
+ * primeiro nó depois da subárvore.
+ *
+ * Os filhos seguem a ordem dos campos da classe correspondente. Um filho
+ * opcional que é o único do nó (inicializador de VarDecl, valor de Return e de
+ * Print) simplesmente não aparece; nos nós com várias posições fixas (If, For,
+ * While, ...) uma posição vazia é ocupada por um nó `NodeKind::None`.
+ *
+ * `payload[i]` depende do tipo do nó: o valor de IntLiteral, os bits do float
+ * de FloatLiteral, o operador de BinaryExpr, o índice em `decls` de VarDecl e,
+ * nos demais, o SymbolId do nome (ou da string).
+ *
+ * `checkType` e `genCode` aplicam as mesmas regras (ast_passes.hpp) que os
+ * métodos homônimos da hierarquia e produzem as mesmas mensagens, tabela de
+ * símbolos e TAC.
+ */
+class FlatAST
+{
+public:
+    static constexpr uint32_t NoNode = UINT32_MAX;
+
+    struct Decl
+    {
+        SymbolId name;
+        TypeId type;
+    };
+
+    std::vector<NodeKind> kind;
+    std::vector<uint32_t> firstChild;
+    std::vector<uint32_t> nextSibling;
+    std::vector<uint32_t> payload;
+    std::vector<SourceOffset> offset;
+    std::vector<Decl> decls;
+
+    // Copia a árvore de `root` (descartando o conteúdo anterior)
+    void build(const ASTNode &root);
+    size_t size() const { return kind.size(); }
+    // Bytes ocupados pelos vetores (só os elementos em uso)
+    size_t bytesUsed() const;
+
+    // Análise semântica a partir da raiz, como ASTNode::checkType
+    TypeId checkType(SymbolTable &symtab) const;
+    // Geração do TAC a partir da raiz, como ASTNode::genCode
+    void genCode(CodeGenerator &gen) const;
+
+private:
+    uint32_t append(NodeKind k, uint32_t value, SourceOffset at);
+};
+
+#endif
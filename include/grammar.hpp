@@ -1,22 +1,102 @@
 #ifndef GRAMMAR_HPP
 #define GRAMMAR_HPP
 
-#include <string>
-#include <map>
-#include <vector>
-#include <set>
+#include "token.hpp"
+#include <array>
+#include <cstdint>
+#include <string_view>
 
+// Não-terminais da gramática LL(1) (ver src/grammar.cpp). Os nomes com apóstrofo
+// da gramática (REL_EXPR', ...) viram *_TAIL aqui; `nonTerminalName` devolve o
+// nome original, usado nas mensagens de erro.
+enum class NonTerminal : uint8_t {
+    PROGRAM, DECL_LIST, DECL, VAR_DECL, DECL_TAIL, TYPE_SPEC, STMT, ASSIGN_OR_CALL, ELSE_PART,
+    FOR_INIT, FOR_UPDATE, RETURN_EXPR, BLOCK, STMT_LIST, BLOCK_ITEM,
+    EXPR, REL_EXPR, REL_EXPR_TAIL, ADD_EXPR, ADD_EXPR_TAIL,
+    MULT_EXPR, MULT_EXPR_TAIL, UNARY_EXPR, PRIMARY, PRIMARY_TAIL,
+    PARAM_LIST, PARAM_LIST_TAIL, ARG_LIST, ARG_LIST_TAIL,
+    COUNT
+};
+
+// Marcadores de ação semântica (#MARK_*, #BUILD_*) inseridos nas produções
+enum class Action : uint8_t {
+    MARK_PROG, BUILD_PROG, EMIT_DECL, MARK_DECL, BUILD_TYPE, BUILD_VAR, BUILD_VARDECL,
+    BUILD_FUNC_ID, MARK_PARAMS, BUILD_FUNC, BUILD_PARAM,
+    MARK_FOR_INIT, BUILD_FOR_INIT, MARK_FOR_UPDATE, BUILD_FOR_UPDATE, BUILD_FOR,
+    BUILD_RETURN, BUILD_BREAK, BUILD_PRINT, BUILD_ASSIGN, BUILD_ARRAY_ASSIGN,
+    MARK_BLOCK, BUILD_BLOCK,
+    BUILD_LT, BUILD_GT, BUILD_LE, BUILD_GE, BUILD_EQ, BUILD_NEQ,
+    BUILD_ADD, BUILD_SUB, BUILD_MUL, BUILD_DIV, BUILD_MOD, BUILD_NEG,
+    BUILD_INT, BUILD_FLOAT, BUILD_STRING, BUILD_ARRAY_ACCESS, MARK_ARGS, BUILD_CALL,
+    COUNT
+};
+
+// Símbolo da gramática codificado em 16 bits: primeiro os terminais (o próprio
+// valor de TokenType), depois os não-terminais e por fim as ações.
+using GrammarSymbol = uint16_t;
+
+/**
+ * @brief Tabela LL(1) densa, indexada por [não-terminal][token].
+ *
+ * A gramática é descrita uma única vez, como lista de produções, em
+ * src/grammar.cpp. Os conjuntos FIRST/FOLLOW e a tabela de previsão são
+ * calculados por código constexpr durante a compilação: não há custo de
+ * construção na inicialização, e um conflito LL(1) é um erro de compilação.
+ *
+ * Cada célula guarda o índice de uma produção (ou `NoProduction`). As produções
+ * são intervalos de um único vetor contíguo de símbolos (`pool`), de modo que o
+ * parser empilha inteiros em vez de copiar vetores de strings.
+ */
 class Grammar {
 public:
-    std::map<std::string, std::vector<std::vector<std::string>>> rules;
+    static constexpr size_t TerminalCount = (size_t)TokenType::ERROR + 1;
+    static constexpr size_t NonTerminalCount = (size_t)NonTerminal::COUNT;
+    static constexpr size_t ActionCount = (size_t)Action::COUNT;
+    static constexpr uint16_t NoProduction = 0xFFFF;
+
+    struct Production {
+        uint16_t first;  // posição do primeiro símbolo em `pool`
+        uint16_t length;
+    };
 
-    Grammar();
-    void buildLL1Table();
-    std::map<std::pair<std::string, std::string>, std::vector<std::string>> ll1table;
+    static constexpr GrammarSymbol tok(TokenType t) { return (GrammarSymbol)t; }
+    static constexpr GrammarSymbol nt(NonTerminal n) { return (GrammarSymbol)(TerminalCount + (size_t)n); }
+    static constexpr GrammarSymbol act(Action a) {
+        return (GrammarSymbol)(TerminalCount + NonTerminalCount + (size_t)a);
+    }
+
+    static constexpr bool isTerminal(GrammarSymbol s) { return s < TerminalCount; }
+    static constexpr bool isAction(GrammarSymbol s) { return s >= TerminalCount + NonTerminalCount; }
+    static constexpr bool isNonTerminal(GrammarSymbol s) { return !isTerminal(s) && !isAction(s); }
+    static constexpr TokenType terminal(GrammarSymbol s) { return (TokenType)s; }
+    static constexpr NonTerminal nonTerminal(GrammarSymbol s) { return (NonTerminal)(s - TerminalCount); }
+    static constexpr Action action(GrammarSymbol s) {
+        return (Action)(s - TerminalCount - NonTerminalCount);
+    }
+
+    static std::string_view nonTerminalName(NonTerminal n);
+    static std::string_view actionName(Action a);
+
+    // Produção prevista para expandir `n` com o token `t` à frente (nullptr se não houver)
+    const Production *predict(NonTerminal n, TokenType t) const {
+        uint16_t p = table[(size_t)n][(size_t)t];
+        return p == NoProduction ? nullptr : &productions[p];
+    }
+    const GrammarSymbol *symbols(const Production &p) const { return pool + p.first; }
+
+    // Se `t` encerra a recuperação de um erro na expansão de `n` (ver src/grammar.cpp)
+    static bool synchronizes(NonTerminal n, TokenType t) {
+        return (syncSets[(size_t)n] >> (size_t)t) & 1;
+    }
 
 private:
-    std::set<std::string> terminals;
-    std::set<std::string> nonTerminals;
+    using Table = std::array<std::array<uint16_t, TerminalCount>, NonTerminalCount>;
+
+    // Gerados em tempo de compilação (src/grammar.cpp)
+    static const Table table;
+    static const Production *const productions;
+    static const GrammarSymbol *const pool;
+    static const std::array<uint64_t, NonTerminalCount> syncSets;
 };
 
 #endif
@@ -0,0 +1,86 @@
+#ifndef INCREMENTAL_PARSER_HPP
+#define INCREMENTAL_PARSER_HPP
+
+#include "arena.hpp"
+#include "ast.hpp"
+#include "diagnostic.hpp"
+#include "symbol_table.hpp"
+#include "token_buffer.hpp"
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Análise incremental: depois de uma edição do código fonte, reanalisa
+ * só o que ela pode ter mudado.
+ *
+ * Guarda o código fonte, o fluxo de tokens e a AST da última análise, além do
+ * primeiro token e do número de itens do programa de cada DECL do nível mais
+ * externo (registrados por #EMIT_DECL). Uma edição troca um trecho de bytes por
+ * um texto novo e:
+ * 1. relê com o Lexer só a região afetada: do penúltimo token antes da edição
+ *    até o primeiro token depois dela que comece na posição (deslocada) de um
+ *    token antigo. Dali em diante o fluxo é o antigo, deslocado;
+ * 2. reanalisa, a partir da DECL que contém o token anterior à região (cujo
+ *    lookahead pode ter mudado), DECL por DECL até voltar a uma fronteira antiga
+ *    depois da região. As demais subárvores são reaproveitadas; as posições das
+ *    seguintes andam o tamanho da edição.
+ *
+ * Um `return;` adota a expressão deixada pela DECL anterior (ver #BUILD_RETURN),
+ * então uma DECL que começa com `return` é reanalisada junto com a anterior. Já
+ * `null` não empilha nó e desalinha a pilha semântica além da DECL em que está:
+ * enquanto houver algum no programa, toda edição leva a uma análise completa.
+ * Um erro léxico ou sintático na região leva a uma análise completa, que relata
+ * os erros como sempre. A AST e `lineIndex()` ficam idênticas às de uma análise
+ * completa do código editado.
+ *
+ * Todos os nós ficam em uma Arena própria. Os das DECLs substituídas continuam
+ * nela até a próxima análise completa, que acontece também quando eles somam
+ * mais que a árvore viva.
+ */
+class IncrementalParser
+{
+public:
+    // Resumo da última análise
+    struct Stats
+    {
+        bool full = true; // análise completa (a primeira, ou depois de um erro)
+        size_t relexedTokens = 0;
+        size_t reparsedDecls = 0;
+        size_t reusedDecls = 0;
+    };
+
+    // Análise completa; devolve false se houver erros (ver diagnostics())
+    bool parse(std::string source);
+    // Troca os bytes [begin, end) do código fonte por `text` e reanalisa
+    bool edit(size_t begin, size_t end, std::string_view text);
+
+    const std::string &source() const { return text; }
+    const TokenBuffer &tokenStream() const { return tokens; }
+    // Nulo se a última análise teve erros
+    ProgramNode *program() const { return root; }
+    const Diagnostics &diagnostics() const { return errors; }
+    const Stats &lastStats() const { return stats; }
+
+private:
+    struct Decl
+    {
+        size_t begin; // primeiro token
+        size_t items; // nós que deixa em ProgramNode::globals
+    };
+
+    std::string text;
+    TokenBuffer tokens;
+    SymbolTable lexSymtab; // exigida pelo Lexer; as ocorrências não são anotadas
+    std::vector<Decl> decls;
+    size_t nullTokens = 0; // ver edit()
+    Arena nodes;
+    size_t fullBytes = 0; // Arena ocupada logo após a última análise completa
+    ProgramNode *root = nullptr;
+    Diagnostics errors;
+    Stats stats;
+
+    bool parseAll();
+};
+
+#endif
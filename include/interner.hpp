@@ -0,0 +1,94 @@
+#ifndef INTERNER_HPP
+#define INTERNER_HPP
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+// Identificador compacto de um nome internado (identificadores, operadores)
+using SymbolId = uint32_t;
+
+/**
+ * @brief Pool global de strings com identificadores de 32 bits.
+ *
+ * Cada texto distinto é copiado uma única vez para uma arena (blocos grandes de
+ * caracteres que nunca são movidos nem liberados antes do fim do programa) e
+ * recebe um `SymbolId` sequencial. A busca usa uma tabela de endereçamento aberto
+ * com sondagem linear, que guarda o hash junto do id para evitar comparações
+ * de texto desnecessárias.
+ *
+ * Depois do Lexer, o restante do compilador (tabela de símbolos, AST e gerador de
+ * código) manipula apenas `SymbolId`s; o texto só é recuperado com `name()` para
+ * impressão e mensagens de erro.
+ */
+class Interner
+{
+private:
+    struct Slot
+    {
+        uint32_t hash;
+        uint32_t idPlusOne; // 0 = posição livre
+    };
+
+    static constexpr size_t BlockSize = 64 * 1024;
+
+    std::vector<std::unique_ptr<char[]>> blocks;
+    char *cursor = nullptr;
+    size_t remaining = 0;
+    std::vector<std::string_view> names;
+    std::vector<Slot> table;
+    std::mutex mutex;
+
+    std::string_view store(std::string_view text);
+    void grow();
+
+public:
+    Interner();
+
+    static uint32_t hash(std::string_view text);
+
+    SymbolId intern(std::string_view text);
+    // Versão segura para uso concorrente por várias threads (ver InternCache)
+    SymbolId internSynchronized(std::string_view text);
+    std::string_view name(SymbolId id) const { return names[id]; }
+    size_t size() const { return names.size(); }
+};
+
+// Instância única usada por todas as fases do compilador
+Interner &interner();
+
+/**
+ * @brief Cache local (por thread) na frente do Interner global.
+ *
+ * Usado pela análise léxica paralela: cada thread resolve localmente os nomes que
+ * já viu e só adquire o lock do Interner global para nomes novos, que são poucos
+ * em relação ao número de ocorrências. As chaves são visões sobre o código fonte.
+ */
+class InternCache
+{
+private:
+    struct Slot
+    {
+        std::string_view text;
+        uint32_t hash;
+        uint32_t idPlusOne; // 0 = posição livre
+    };
+
+    std::vector<Slot> table;
+    size_t count = 0;
+
+    void grow();
+
+public:
+    InternCache();
+    SymbolId intern(std::string_view text);
+};
+
+inline std::string_view symbolName(SymbolId id)
+{
+    return interner().name(id);
+}
+
+#endif
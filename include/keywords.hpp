@@ -0,0 +1,111 @@
+#ifndef KEYWORDS_HPP
+#define KEYWORDS_HPP
+
+#include "token.hpp"
+#include <array>
+#include <cstddef>
+#include <string_view>
+
+/**
+ * @brief Reconhecimento de palavras-chave por hash perfeito gerado em tempo de compilação.
+ *
+ * A lista `keywords` abaixo é a única fonte das palavras reservadas. A partir dela,
+ * `buildKeywordTable()` monta (via constexpr) uma tabela de 32 posições indexada por
+ * `keywordHash`, que usa apenas o tamanho, o primeiro e o último caractere da palavra.
+ * Se duas palavras-chave colidirem, o `static_assert` falha na compilação.
+ *
+ * Assim, `keywords::lookup` faz no máximo uma comparação de string por identificador,
+ * em vez de testar as 13 palavras-chave em sequência.
+ */
+
+namespace keywords
+{
+    struct Keyword
+    {
+        std::string_view text;
+        TokenType type;
+    };
+
+    inline constexpr Keyword list[] = {
+        {"int", TokenType::KW_INT},
+        {"float", TokenType::KW_FLOAT},
+        {"string", TokenType::KW_STRING},
+        {"def", TokenType::KW_DEF},
+        {"for", TokenType::KW_FOR},
+        {"if", TokenType::KW_IF},
+        {"else", TokenType::KW_ELSE},
+        {"return", TokenType::KW_RETURN},
+        {"break", TokenType::KW_BREAK},
+        {"print", TokenType::KW_PRINT},
+        {"read", TokenType::KW_READ},
+        {"new", TokenType::KW_NEW},
+        {"null", TokenType::KW_NULL},
+    };
+
+    inline constexpr size_t tableSize = 32;
+
+    constexpr size_t minLength()
+    {
+        size_t m = list[0].text.size();
+        for (const auto &kw : list)
+            m = kw.text.size() < m ? kw.text.size() : m;
+        return m;
+    }
+
+    constexpr size_t maxLength()
+    {
+        size_t m = 0;
+        for (const auto &kw : list)
+            m = kw.text.size() > m ? kw.text.size() : m;
+        return m;
+    }
+
+    // Só deve ser chamada com palavras não vazias
+    constexpr size_t hash(std::string_view word)
+    {
+        return (word.size() + (unsigned char)word.front() + ((unsigned char)word.back() << 2)) & (tableSize - 1);
+    }
+
+    struct Slot
+    {
+        std::string_view text; // vazio = posição livre
+        TokenType type = TokenType::IDENT;
+    };
+
+    constexpr std::array<Slot, tableSize> buildTable()
+    {
+        std::array<Slot, tableSize> table{};
+        for (const auto &kw : list)
+        {
+            Slot &slot = table[hash(kw.text)];
+            slot.text = kw.text;
+            slot.type = kw.type;
+        }
+        return table;
+    }
+
+    inline constexpr std::array<Slot, tableSize> table = buildTable();
+
+    constexpr bool isPerfect()
+    {
+        for (const auto &kw : list)
+        {
+            if (table[hash(kw.text)].text != kw.text)
+                return false;
+        }
+        return true;
+    }
+
+    static_assert(isPerfect(), "Colisão no hash de palavras-chave: ajuste keywords::hash");
+
+    // Retorna o TokenType da palavra-chave ou TokenType::IDENT
+    constexpr TokenType lookup(std::string_view word)
+    {
+        if (word.size() < minLength() || word.size() > maxLength())
+            return TokenType::IDENT;
+        const Slot &slot = table[hash(word)];
+        return slot.text == word ? slot.type : TokenType::IDENT;
+    }
+}
+
+#endif
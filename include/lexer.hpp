@@ -2,26 +2,71 @@
 #define LEXER_HPP
 
 #include "token.hpp"
+#include "line_index.hpp"
 #include "symbol_table.hpp"
 #include <string>
+#include <string_view>
+
+class StreamSource;
 
 class Lexer {
 private:
-    std::string src;
+    // O Lexer não copia o código fonte: os lexemas dos tokens são visões
+    // sobre este buffer, que deve permanecer vivo enquanto os tokens forem usados.
+    std::string_view src;
     size_t index;
-    int line, col;
+    // Deslocamento de `src` no arquivo (diferente de 0 ao analisar um trecho)
+    SourceOffset base;
     SymbolTable &symbols;
+    bool recordOccurrences = true;
+    InternCache *internCache = nullptr;
+    // O Lexer não conta linhas e colunas: só registra onde cada linha começa
+    LineIndex *lines = &lineIndex();
+    std::string errorMessage;
+    SourceOffset errorEnd = NoOffset;
+
+    // Entrada em fluxo (opcional): `src` é só a janela atual da fonte, que é
+    // reabastecida quando o Lexer chega ao fim dela. `tokenStart` marca o início
+    // do token em andamento, que deve ser mantido na janela.
+    StreamSource *stream = nullptr;
+    size_t tokenStart = 0;
+    bool truncated = false;
+    std::string lexemeSlots[2];
+    int slot = 0;
 
+    bool refill();
+    Token scanToken();
     char peek();
     char advance();
     void skipWhitespace();
+    void recordNewlines(size_t from, size_t to);
+    SourceOffset offsetOf(size_t i) const { return base + (SourceOffset)i; }
     Token number();
     Token identifier();
     Token stringLiteral();
+    Token symbol(TokenType type);
+    Token error(std::string message);
 
 public:
-    Lexer(const std::string &input, SymbolTable &symtab);
+    Lexer(std::string_view input, SymbolTable &symtab, SourceOffset baseOffset = 0);
+    // Lê a entrada aos poucos, com memória limitada (ver StreamSource). Neste modo,
+    // o lexema de um token só vale até a segunda chamada seguinte de nextToken().
+    Lexer(StreamSource &input, SymbolTable &symtab);
     Token nextToken();
+    std::string_view input() const { return src; }
+
+    // Um token ERROR fica na posição em que o trecho inválido começa, mas o erro é
+    // reportado na linha em que foi detectado (para uma string não terminada, a
+    // linha do fim do arquivo), como quando o Lexer contava linhas.
+    SourceOffset errorOffset() const { return errorEnd; }
+
+    // Faz o Lexer internar identificadores através de um cache local (uso em threads)
+    void setInternCache(InternCache *cache) { internCache = cache; }
+    // Faz o Lexer registrar os inícios de linha em outra tabela (uso em threads)
+    void setLineIndex(LineIndex *index) { lines = index; }
+    // Deixa de anotar as ocorrências dos identificadores na tabela de símbolos,
+    // que crescem com o programa (--tac-only não as lê)
+    void setRecordOccurrences(bool record) { recordOccurrences = record; }
 };
 
 #endif
@@ -0,0 +1,60 @@
+#ifndef LINE_INDEX_HPP
+#define LINE_INDEX_HPP
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+// Deslocamento (em bytes) de um ponto do código fonte
+using SourceOffset = uint32_t;
+
+// Posição ausente (nós da AST sem origem, declarações da tabela semântica)
+constexpr SourceOffset NoOffset = std::numeric_limits<SourceOffset>::max();
+
+struct SourcePosition
+{
+    int line;
+    int column;
+};
+
+/**
+ * @brief Tabela com o deslocamento do início de cada linha do código fonte.
+ *
+ * Tokens, ocorrências na tabela de símbolos e nós da AST guardam apenas um
+ * deslocamento de 32 bits. Linha e coluna são calculadas sob demanda (em mensagens
+ * de erro e na impressão da tabela de símbolos) por busca binária nesta tabela,
+ * que o Lexer preenche à medida que encontra quebras de linha. A coluna é contada
+ * em bytes a partir de 1, como antes.
+ *
+ * `NoOffset` corresponde à posição (0, 0).
+ */
+class LineIndex
+{
+private:
+    std::vector<SourceOffset> starts{0};
+
+public:
+    // Registra o início de uma linha; os inícios chegam em ordem crescente
+    void addLineStart(SourceOffset offset)
+    {
+        if (offset > starts.back())
+            starts.push_back(offset);
+    }
+
+    // Acrescenta os inícios de linha de outra tabela (um trecho posterior do arquivo)
+    void append(const LineIndex &next);
+
+    // Edição do código fonte (análise incremental): os inícios em (from, to] dão
+    // lugar aos de `region` em (from, to + delta] e os seguintes andam `delta`
+    void splice(SourceOffset from, SourceOffset to, const LineIndex &region, int64_t delta);
+
+    SourcePosition locate(SourceOffset offset) const;
+    int line(SourceOffset offset) const { return locate(offset).line; }
+    size_t lineCount() const { return starts.size(); }
+};
+
+// Tabela de linhas do arquivo sendo compilado (preenchida pelo Lexer)
+LineIndex &lineIndex();
+
+#endif
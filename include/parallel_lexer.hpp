@@ -0,0 +1,28 @@
+#ifndef PARALLEL_LEXER_HPP
+#define PARALLEL_LEXER_HPP
+
+#include "symbol_table.hpp"
+#include "token_buffer.hpp"
+#include <string_view>
+
+/**
+ * @brief Análise léxica paralela de arquivos grandes (opção --lex-threads=N).
+ *
+ * O código fonte é dividido em `threads` trechos que terminam em quebras de
+ * linha, e cada trecho é analisado por um `Lexer` próprio em uma thread, com a
+ * sua tabela de símbolos e um `InternCache` local. ConvCC não tem comentários de
+ * bloco e nenhum token além de strings atravessa uma quebra de linha, então um
+ * trecho só é analisado de forma diferente da serial quando corta uma string ao
+ * meio (o trecho anterior termina em "Unterminated string") ou quando contém um
+ * byte nulo (o Lexer para nele). Nesses casos, tudo a partir do trecho suspeito é
+ * reanalisado serialmente. Como as posições são deslocamentos no arquivo, os
+ * fluxos são simplesmente concatenados e o resultado é idêntico ao de
+ * `TokenBuffer::lexAll`.
+ *
+ * As ocorrências de identificadores são acrescentadas a `symtab` e os inícios de
+ * linha, a `lines`.
+ */
+TokenBuffer lexParallel(std::string_view source, SymbolTable &symtab, LineIndex &lines,
+                        unsigned threads);
+
+#endif
@@ -2,35 +2,224 @@
 #define PARSER_HPP
 
 #include "token.hpp"
+#include "arena.hpp"
 #include "lexer.hpp"
+#include "token_buffer.hpp"
+#include "token_pipe.hpp"
 #include "grammar.hpp"
 #include "ast.hpp"
 #include "code_generator.hpp"
+#include "diagnostic.hpp"
+#include "flat_ast.hpp"
+#include <cstdint>
+#include <system_error>
+#include <functional>
+#include <ostream>
 #include <stack>
 #include <vector>
 
+/**
+ * @brief Execuções e tempo acumulado de cada ação semântica (opção --action-stats).
+ */
+struct ActionStats
+{
+    uint64_t count[Grammar::ActionCount] = {};
+    uint64_t nanoseconds[Grammar::ActionCount] = {};
+
+    // Tabela ordenada pelo tempo total, da ação mais cara para a mais barata
+    void print(std::ostream &out) const;
+};
+
+// Fim de uma DECL do nível mais externo (ver #EMIT_DECL): índice, no TokenBuffer,
+// do primeiro token depois dela e número de itens do programa até ali
+struct DeclBoundary
+{
+    size_t token;
+    size_t items;
+};
+
+// Algoritmo usado para reconhecer o programa (opção --parser=)
+enum class ParserBackend
+{
+    Table,  // LL(1) dirigido pela tabela, com ações semânticas (referência)
+    Descent // descida recursiva + precedência de operadores (src/parser_rd.cpp)
+};
+
 class Parser
 {
 private:
-    Lexer &lexer;
+    // Fonte dos tokens: o Lexer (sob demanda), um TokenBuffer pré-computado ou
+    // um TokenPipe alimentado por outra thread
+    Lexer *lexer = nullptr;
+    const TokenBuffer *tokens = nullptr;
+    TokenPipe *pipe = nullptr;
+    // Com --pipeline ou --parse-threads, internar exige o lock do Interner
+    bool sharedInterner = false;
+    size_t tokenPos = 0;
+
     Grammar grammar;
     Token current;
     Token previous;
-    std::stack<ASTNode *> semanticStack;
-    std::string lastType;
+    // Apoiada em vector: nenhuma alocação por nó empilhado depois que a pilha aquece
+    std::stack<ASTNode *, std::vector<ASTNode *>> semanticStack;
+    TypeId lastType = TypeId::None;
     std::vector<VarDeclNode *> tempParams;
+    std::vector<ASTNode *> scratch; // ver popToMarker()
+
+    // Todos os nós vão para `arena`: a própria, ou uma externa (ver setArena)
+    Arena ownArena;
+    Arena *arena = &ownArena;
+    // Nós de identificador que só serviam para levar o nome (ver makeName)
+    std::vector<VarAccess *> freeNames;
 
     CodeGenerator gen;
 
+    // Não nulo apenas no modo --action-stats
+    ActionStats *actionStats = nullptr;
+
+    ParserBackend backend = ParserBackend::Table;
+
+    // Não nulos apenas no modo --tac-only (ver emitGlobals)
+    std::ostream *tacOut = nullptr;
+    SymbolTable *tacSymtab = nullptr;
+    std::ostream *tacCodeLog = nullptr;
+    // Não nulo apenas no modo --flat-ast (ver setFlatAST)
+    FlatAST *flat = nullptr;
+    // Não nulo apenas na análise incremental (ver setDeclBoundaries)
+    std::vector<DeclBoundary> *boundaries = nullptr;
+
+    // --- Erros e recuperação (modo pânico) ---
+    Diagnostics errors;
+    size_t maxErrors = DefaultMaxErrors;
+    bool recovering = false; // erro ainda não superado: os seguintes não são relatados
+    bool building = true;    // desligado no primeiro erro; a AST seria descartada
+    bool aborted = false;    // erro léxico ou limite de erros: a análise termina
+    bool descending = false; // dentro do backend Descent, que não se recupera
+
     void advance();
-    bool isTerminal(const std::string &symbol);
-    bool matchTerminal(const std::string &terminal, TokenType type);
-    void performAction(const std::string &action);
+    void report(DiagnosticKind kind, SourceOffset offset, std::string message);
+    void expectedError(TokenType expected);
+    void noProductionError(NonTerminal nonTerminal);
+    void actionError(std::string message);
+    void literalError(const char *kind, std::errc ec);
+    void discardSemanticStack();
+    VarAccess *makeName(SymbolId name, SourceOffset offset);
+    void dropName(VarAccess *node);
+    ExprNode *literalFromPrevious(TokenType type);
+    void performAction(Action action);
+    void timedAction(Action action);
+    void buildBinary(Action action);
+    void popToMarker();
+    void emitGlobals(bool all);
+    void buildTreeTable();
+    void runTable(NonTerminal start);
+
+    // --- Análise paralela das funções (src/parallel_parser.cpp) ---
+    // Cada `def` no nível mais externo, de KW_DEF até o '}' que fecha o corpo
+    // (índices no TokenBuffer), já analisado por uma thread auxiliar. `node` é
+    // nulo se a análise isolada falhou; o trecho é então analisado pelo laço.
+    struct PreparsedFunction
+    {
+        size_t begin, end;
+        ASTNode *node;
+        TypeId lastType;
+    };
+    unsigned parseThreads = 1;
+    std::vector<PreparsedFunction> preparsed;
+    // Uma por thread, já que a Arena não é compartilhável; vivem tanto quanto o parser
+    std::vector<Arena> workerArenas;
+    size_t nextPreparsed = 0;
+
+    void preparseFunctions();
+    void parseFunction(PreparsedFunction &function);
+    bool splicePreparsed();
+
+    // --- Backend de descida recursiva (src/parser_rd.cpp) ---
+    // Constrói a mesma AST que as ações semânticas, diretamente, sem pilha
+    // semântica. Os itens de um bloco (ou do programa) vão para `items` na ordem
+    // em que as ações da tabela os empilhariam. Qualquer erro lança
+    // TableFallback, e a tabela relê o programa para relatar e se recuperar (os
+    // nós já construídos ficam na Arena).
+    using NodeList = ArenaVector<ASTNode *>;
+    struct TableFallback {};
+
+    NodeList nodeList() { return NodeList(ArenaAllocator<ASTNode *>(*arena)); }
+    ProgramNode *descendProgram();
+    void descendDecl(NodeList &items);
+    void descendVarDecl(NodeList &items);
+    void descendStatement(NodeList &items);
+    BlockNode *descendBlock();
+    StmtNode *descendForClause(NonTerminal clause);
+    void descendArgs(NodeList &args);
+    ExprNode *descendExpr(NonTerminal entry, int minPrecedence = 0);
+    ExprNode *descendUnary(NonTerminal entry);
+    ExprNode *descendPrimary();
+    void match(TokenType expected);
+    void predictOrFail(NonTerminal nonTerminal);
+
+    // A descida usa a pilha nativa: um nível por bloco, parênteses, índice,
+    // argumento ou '-' unário aninhado. Acima deste limite ela desiste
+    // (TableFallback) antes de esgotá-la, e a tabela, que não recursa, relê o programa
+    static constexpr unsigned MaxDescentDepth = 2000;
+    unsigned descentDepth = 0;
+    struct NestingGuard
+    {
+        Parser &parser;
+        explicit NestingGuard(Parser &p);
+        ~NestingGuard() { --parser.descentDepth; }
+    };
 
 public:
+    // Limite padrão de erros relatados em uma análise (0 = sem limite)
+    static constexpr size_t DefaultMaxErrors = 20;
+
     Parser(Lexer &lex);
+    Parser(const TokenBuffer &buffer);
+    Parser(TokenPipe &tokenPipe);
+    ~Parser();
+    // Análise sintática completa: constrói a AST, imprime-a e gera o TAC
     void parse();
-    std::unique_ptr<ASTNode> root;
+    // Apenas o reconhecimento do programa e a construção da AST (em `root`)
+    void buildTree();
+    // O backend Descent exige o construtor com TokenBuffer (ver buildTree)
+    void setBackend(ParserBackend b) { backend = b; }
+    void setActionStats(ActionStats *stats) { actionStats = stats; }
+    void setMaxErrors(size_t limit) { maxErrors = limit; }
+    // Analisa os corpos das funções com `threads` threads (exige o TokenBuffer)
+    void setParseThreads(unsigned threads) { parseThreads = threads; }
+    // Tradução em uma passada: cada declaração do nível mais externo é traduzida
+    // para `out`, verificada com `symtab` e liberada assim que termina; as
+    // mensagens da geração de código vão para `codeLog`. `parse()` não imprime a
+    // AST, e `root` fica com um ProgramNode vazio. Um `null` encerra a análise
+    // com erro (ver advance).
+    void setTranslation(std::ostream *out, SymbolTable *symtab, std::ostream *codeLog)
+    {
+        tacOut = out;
+        tacSymtab = symtab;
+        tacCodeLog = codeLog;
+    }
+    // `parse()` copia a AST para `out` e gera o TAC a partir da cópia
+    void setFlatAST(FlatAST *out) { flat = out; }
+    // Registra em `out` o fim de cada DECL do nível mais externo (exige o TokenBuffer)
+    void setDeclBoundaries(std::vector<DeclBoundary> *out) { boundaries = out; }
+    // Constrói os nós em `target`, que deve viver mais que a AST, em vez da
+    // Arena própria do parser (destruída com ele)
+    void setArena(Arena *target) { arena = target; }
+
+    // --- Análise incremental (src/incremental_parser.cpp) ---
+    // Analisa DECLs do nível mais externo a partir do token `begin` até o fim do
+    // programa ou até um token i, seguinte a uma delas, para o qual `stop(i)` seja
+    // verdadeiro. Os fins vão para `setDeclBoundaries` (com `items` contado a
+    // partir de `begin`) e os nós, na ordem, para `items`. Falha com qualquer erro.
+    bool parseDecls(size_t begin, const std::function<bool(size_t)> &stop,
+                    std::vector<ASTNode *> &items);
+
+    // Erros encontrados, na ordem em que ocorreram; com algum erro, `root` é nulo
+    const Diagnostics &diagnostics() const { return errors; }
+    bool hasErrors() const { return !errors.empty(); }
+    bool errorLimitReached() const { return maxErrors != 0 && errors.size() >= maxErrors; }
+    // Raiz da AST, na Arena do parser
+    ASTNode *root = nullptr;
 
     CodeGenerator& getGen() {
         return gen;
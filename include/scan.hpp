@@ -0,0 +1,28 @@
+#ifndef SCAN_HPP
+#define SCAN_HPP
+
+#include <cstddef>
+
+/**
+ * @brief Varredura vetorizada de sequências de caracteres usada pelo Lexer.
+ *
+ * Cada função recebe o intervalo [p, end) e retorna o tamanho do prefixo que
+ * pertence à classe de caracteres correspondente. As versões AVX2 (32 bytes por
+ * iteração) e SSE2 (16 bytes) são escolhidas em tempo de execução conforme a CPU;
+ * fora de x86-64 é usada a versão escalar.
+ *
+ * As classes seguem o locale "C", o mesmo usado por `isspace`/`isalnum`:
+ * - espaço: ' ', '\t', '\n', '\v', '\f', '\r'
+ * - identificador: [a-zA-Z0-9_]
+ */
+namespace scan
+{
+    size_t whitespaceRun(const char *p, const char *end);
+    size_t identifierRun(const char *p, const char *end);
+    size_t countNewlines(const char *p, const char *end);
+
+    // Nome da implementação selecionada ("avx2", "sse2" ou "scalar")
+    const char *implementation();
+}
+
+#endif
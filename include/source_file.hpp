@@ -0,0 +1,37 @@
+#ifndef SOURCE_FILE_HPP
+#define SOURCE_FILE_HPP
+
+#include <string>
+#include <string_view>
+
+/**
+ * @brief Buffer somente-leitura com o conteúdo de um arquivo fonte.
+ *
+ * Arquivos regulares são mapeados em memória com `mmap`, de modo que o `Lexer`
+ * percorre diretamente as páginas do arquivo sem nenhuma cópia. Quando o
+ * mapeamento não é possível (pipes, dispositivos, sistemas de arquivos sem
+ * suporte), o conteúdo é lido com `read` para um `std::string` interno.
+ *
+ * A visão retornada por `contents()` (e portanto os lexemas dos tokens)
+ * permanece válida enquanto o objeto existir.
+ */
+class SourceFile
+{
+private:
+    const char *mapped = nullptr;
+    size_t mappedSize = 0;
+    std::string fallback;
+    std::string_view data;
+
+public:
+    SourceFile() = default;
+    ~SourceFile();
+    SourceFile(const SourceFile &) = delete;
+    SourceFile &operator=(const SourceFile &) = delete;
+
+    bool open(const std::string &path);
+    std::string_view contents() const { return data; }
+    bool isMapped() const { return mapped != nullptr; }
+};
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef STREAM_SOURCE_HPP
+#define STREAM_SOURCE_HPP
+
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Entrada lida em blocos, para arquivos (ou pipes) maiores que a memória.
+ *
+ * Ao contrário de `SourceFile`, o conteúdo nunca fica inteiro na memória: a fonte
+ * mantém uma janela de tamanho limitado que o `Lexer` reabastece quando chega ao
+ * fim dela. A cada reabastecimento, os bytes anteriores ao token em andamento
+ * são descartados, o restante do token é movido para o início da janela e um novo
+ * bloco é lido em seguida. Assim um token pode atravessar a fronteira entre dois
+ * blocos, e o buffer só cresce além de `blockSize` para um token maior que isso.
+ *
+ * A janela é mantida contígua (em vez de dar a volta como um anel) porque os
+ * lexemas são visões sobre ela.
+ */
+class StreamSource
+{
+private:
+    int fd = -1;
+    bool ownsFd = false;
+    bool finished = false;
+    bool failed = false;
+    size_t blockSize;
+    std::vector<char> buffer;
+    size_t used = 0;
+
+public:
+    explicit StreamSource(size_t blockSize = 1 << 16);
+    ~StreamSource();
+    StreamSource(const StreamSource &) = delete;
+    StreamSource &operator=(const StreamSource &) = delete;
+
+    // "-" lê da entrada padrão
+    bool open(const std::string &path);
+
+    // Descarta os bytes antes de `keepFrom` (informando quantos em `discarded`) e
+    // lê mais um bloco. Retorna o número de bytes lidos (0 no fim da entrada).
+    size_t refill(size_t keepFrom, size_t &discarded);
+
+    std::string_view contents() const { return {buffer.data(), used}; }
+    size_t capacity() const { return buffer.capacity(); }
+    bool readFailed() const { return failed; }
+};
+
+#endif
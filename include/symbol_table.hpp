@@ -1,31 +1,49 @@
 #ifndef SYMBOL_TABLE_HPP
 #define SYMBOL_TABLE_HPP
 
+#include "interner.hpp"
+#include "line_index.hpp"
+#include "types.hpp"
 #include <string>
 #include <unordered_map>
 #include <vector>
 
 struct SymbolEntry
 {
-    std::string name;
-    std::vector<std::pair<int, int>> occurrences;
-    std::string type; // será usado na fase semântica futuramente
+    SymbolId name;
+    std::vector<SourceOffset> occurrences; // linha e coluna via lineIndex()
+    TypeId type = TypeId::None; // atribuído pela análise semântica, na declaração
+    SymbolEntry *shadowed = nullptr; // entrada do mesmo nome que esta esconde
 };
 
 class SymbolTable
 {
 private:
-    std::vector<std::unordered_map<std::string, SymbolEntry>> scopes;
+    // Os escopos são indexados pelo id internado do nome, não pelo texto
+    std::vector<std::unordered_map<SymbolId, SymbolEntry>> scopes;
+    // Entrada visível de cada nome (a do escopo mais interno), indexada pelo
+    // SymbolId; as que ela esconde seguem `shadowed`. Assim `lookup` não
+    // percorre os escopos um a um, o que seria quadrático em programas com
+    // muitos blocos aninhados
+    std::vector<SymbolEntry *> visible;
 
 public:
     SymbolTable();
+    // `visible` aponta para as entradas de `scopes`: a tabela pode ser movida,
+    // mas não copiada
+    SymbolTable(const SymbolTable &) = delete;
+    SymbolTable &operator=(const SymbolTable &) = delete;
+    SymbolTable(SymbolTable &&) = default;
+    SymbolTable &operator=(SymbolTable &&) = default;
     void enterScope();
     void exitScope();
-    void addOccurrence(const std::string &name, int line, int col);
-    SymbolEntry *lookup(const std::string &name);
-    bool exists(const std::string &name);
-    bool definedInCurrentScope(const std::string &name);
-    const SymbolEntry &get(const std::string &name);
+    void addOccurrence(SymbolId name, SourceOffset offset);
+    SymbolEntry *lookup(SymbolId name);
+    bool exists(SymbolId name);
+    bool definedInCurrentScope(SymbolId name);
+    const SymbolEntry &get(SymbolId name);
+    // Acrescenta as ocorrências do escopo global de `other`
+    void merge(const SymbolTable &other);
     void print() const;
 };
 
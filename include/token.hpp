@@ -1,7 +1,10 @@
 #ifndef TOKEN_HPP
 #define TOKEN_HPP
 
+#include "interner.hpp"
+#include "line_index.hpp"
 #include <string>
+#include <string_view>
 
 enum class TokenType {
     IDENT, INT_CONST, FLOAT_CONST, STRING_CONST,
@@ -14,11 +17,34 @@ enum class TokenType {
     END_OF_FILE, ERROR
 };
 
+// O lexema é uma visão sobre o buffer do código fonte (mantido vivo por quem
+// criou o Lexer), evitando uma alocação por token. Para tokens ERROR, aponta
+// para a mensagem de erro guardada no próprio Lexer. Identificadores também
+// carregam o `SymbolId` do nome, internado pelo Lexer.
+// A posição é o deslocamento do primeiro caractere do token (a aspa de abertura,
+// no caso de strings); linha e coluna vêm de `lineIndex()` quando necessário.
 struct Token {
     TokenType type;
-    std::string lexeme;
-    int line;
-    int column;
+    std::string_view lexeme;
+    SourceOffset offset;
+    SymbolId symbol = 0;
+
+    // Uma string pode atravessar quebras de linha; como sempre, ela é reportada
+    // na linha em que termina (a da aspa de fechamento) e na coluna em que começa.
+    SourceOffset lineOffset() const
+    {
+        if (type == TokenType::STRING_CONST)
+            return offset + 1 + (SourceOffset)lexeme.size();
+        return offset;
+    }
+
+    SourcePosition position() const
+    {
+        SourcePosition pos = lineIndex().locate(offset);
+        if (type == TokenType::STRING_CONST)
+            pos.line = lineIndex().line(lineOffset());
+        return pos;
+    }
 };
 
 #endif
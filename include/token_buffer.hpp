@@ -0,0 +1,68 @@
+#ifndef TOKEN_BUFFER_HPP
+#define TOKEN_BUFFER_HPP
+
+#include "token.hpp"
+#include "lexer.hpp"
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * @brief Fluxo de tokens pré-computado, armazenado como estrutura de arrays (SoA).
+ *
+ * Em vez de um vetor de `Token` (tipo + string_view + linha + coluna = 32 bytes),
+ * cada token ocupa apenas:
+ * - 1 byte de tipo (`types`);
+ * - 4 bytes de posição do token no código fonte (`offsets`);
+ * - 4 bytes de carga (`payload`): o `SymbolId` para identificadores e o tamanho
+ *   do lexema para os demais tokens (o texto de um identificador vem do `Interner`).
+ *
+ * Linha e coluna não são guardadas: vêm de `lineIndex()`, preenchida pelo Lexer.
+ *
+ * O lexema de um token é reconstruído como uma visão sobre o código fonte, que
+ * deve permanecer vivo enquanto o buffer for usado. Um erro léxico encerra o
+ * buffer com um token ERROR cuja mensagem fica em `errorMessage`.
+ */
+class TokenBuffer
+{
+private:
+    std::string_view source;
+    std::vector<uint8_t> types;
+    std::vector<uint32_t> offsets;
+    std::vector<uint32_t> payload;
+    std::string errorMessage;
+    SourceOffset errorEnd = NoOffset;
+
+    void push(const Token &tok);
+    static uint32_t payloadOf(const Token &tok);
+
+public:
+    // Executa o Lexer até END_OF_FILE (ou até o primeiro erro léxico)
+    static TokenBuffer lexAll(Lexer &lexer, std::string_view source);
+
+    // O buffer usa deslocamentos de 32 bits
+    static bool fits(std::string_view source);
+
+    // Concatena o fluxo de `next` (um trecho posterior do mesmo código fonte),
+    // descartando o END_OF_FILE atual
+    void append(const TokenBuffer &next);
+
+    // Edição do código fonte (análise incremental): troca os tokens [from, to) por
+    // `region`, já nas posições novas, e desloca `delta` bytes os seguintes.
+    // `source` é o código fonte editado.
+    void splice(size_t from, size_t to, const std::vector<Token> &region, int64_t delta, std::string_view source);
+
+    size_t size() const { return types.size(); }
+    TokenType type(size_t i) const { return static_cast<TokenType>(types[i]); }
+    SourceOffset offset(size_t i) const { return offsets[i]; }
+    std::string_view lexeme(size_t i) const;
+    Token get(size_t i) const;
+    // Ver `Lexer::errorOffset`
+    SourceOffset errorOffset() const { return errorEnd; }
+
+    // Bytes ocupados pelos arrays do buffer (sem contar o código fonte)
+    size_t memoryUsage() const;
+};
+
+#endif
@@ -0,0 +1,88 @@
+#ifndef TOKEN_PIPE_HPP
+#define TOKEN_PIPE_HPP
+
+#include "token.hpp"
+#include "lexer.hpp"
+#include "line_index.hpp"
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <thread>
+
+/**
+ * @brief Análise léxica em uma thread produtora, em paralelo com o parser
+ * (opção --pipeline).
+ *
+ * O Lexer roda em uma thread própria e publica lotes de `BatchSize` tokens em
+ * um anel de `RingSize` lotes com um único produtor e um único consumidor. Os
+ * índices `published` e `consumed` só crescem e cada um é escrito por uma única
+ * thread, então o anel não usa locks: o produtor preenche um lote e o publica
+ * com uma escrita release, e o consumidor o lê após uma leitura acquire.
+ *
+ * - Contrapressão: com o anel cheio, o produtor espera o parser liberar um lote,
+ *   então a memória usada é limitada independentemente do tamanho do arquivo.
+ * - Fim: o lote com END_OF_FILE ou com o primeiro token ERROR é o último; a
+ *   thread termina logo depois de publicá-lo. `stop()` (também chamado pelo
+ *   destrutor) interrompe o produtor quando o parser para antes do fim.
+ *
+ * Enquanto o produtor roda, nada fora daqui pode tocar no estado global que o
+ * Lexer altera. Por isso ele interna nomes por um `InternCache` (que usa o lock
+ * do Interner) e registra os inícios de linha no próprio lote; o consumidor os
+ * acrescenta a `lineIndex()` ao receber o lote, antes de entregar seus tokens.
+ * A tabela de símbolos do Lexer só pode ser lida depois de `stop()`.
+ */
+class TokenPipe
+{
+public:
+    static constexpr size_t BatchSize = 4096;
+    static constexpr size_t RingSize = 8; // potência de 2
+
+    explicit TokenPipe(Lexer &lexer);
+    ~TokenPipe();
+    TokenPipe(const TokenPipe &) = delete;
+    TokenPipe &operator=(const TokenPipe &) = delete;
+
+    // Próximo token; depois de END_OF_FILE ou ERROR, repete o último indefinidamente
+    Token next()
+    {
+        if (position < available)
+            return batch->tokens[position++];
+        return nextBatch();
+    }
+
+    // Ver `Lexer::errorOffset`; válido depois que o token ERROR foi recebido
+    SourceOffset errorOffset() const { return errorEnd; }
+
+    // Encerra o produtor (se ainda estiver rodando) e espera a thread terminar
+    void stop();
+
+private:
+    struct Batch
+    {
+        Token tokens[BatchSize];
+        size_t count = 0;
+        LineIndex lines;
+    };
+
+    Lexer &lexer;
+    std::unique_ptr<Batch[]> ring;
+    SourceOffset errorEnd = NoOffset;
+
+    // Lotes publicados (escrito só pelo produtor) e liberados (só pelo consumidor)
+    alignas(64) std::atomic<size_t> published{0};
+    alignas(64) std::atomic<size_t> consumed{0};
+    std::atomic<bool> stopping{false};
+
+    // Estado do consumidor: lote atual e posição nele
+    alignas(64) Batch *batch = nullptr;
+    size_t position = 0;
+    size_t available = 0;
+    bool finished = false;
+
+    std::thread producer;
+
+    void produce();
+    Token nextBatch();
+};
+
+#endif
@@ -0,0 +1,51 @@
+#ifndef TYPES_HPP
+#define TYPES_HPP
+
+#include "token.hpp"
+#include <cstdint>
+#include <ostream>
+#include <string_view>
+
+/**
+ * @brief Tipo da análise semântica, em 32 bits.
+ *
+ * A análise semântica só produz tipos primitivos (`int v[n]` declara `v` como
+ * `int`, e uma função tem o tipo do seu retorno), cada um com um valor fixo.
+ * Assim, verificar a compatibilidade de dois tipos é comparar dois inteiros, e o
+ * texto ("int", "float", ...) só é usado em mensagens de erro, na impressão da
+ * AST e na tabela de símbolos.
+ */
+enum class TypeId : uint32_t
+{
+    None,  // sem tipo: comandos, ou nome ainda não declarado (impresso como "")
+    Void,
+    Int,
+    Float,
+    String,
+    Error  // erro já relatado
+};
+
+std::string_view typeName(TypeId type);
+
+inline std::ostream &operator<<(std::ostream &out, TypeId type)
+{
+    return out << typeName(type);
+}
+
+// Tipo nomeado pela palavra-chave de TYPE_SPEC (KW_INT, KW_FLOAT, KW_STRING)
+inline TypeId typeOfKeyword(TokenType keyword)
+{
+    switch (keyword)
+    {
+    case TokenType::KW_INT:
+        return TypeId::Int;
+    case TokenType::KW_FLOAT:
+        return TypeId::Float;
+    case TokenType::KW_STRING:
+        return TypeId::String;
+    default:
+        return TypeId::None;
+    }
+}
+
+#endif